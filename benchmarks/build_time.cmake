@@ -0,0 +1,50 @@
+#  Copyright (c) 2025 Alexander Wachter
+# 
+#  SPDX-License-Identifier: Apache-2.0
+
+# Builds compile time benchmark targets from scratch and prints the wall time of each
+# cmake -DBUILD_DIR=<build dir configured with ENABLE_BENCHMARKS> [-DTARGETS=<a;b>] [-DJOBS=<n>] -P benchmarks/build_time.cmake
+# Without TARGETS, the parse time and memoize benchmarks are run.
+
+cmake_minimum_required(VERSION 3.23)
+
+if(NOT BUILD_DIR)
+    message(FATAL_ERROR "set BUILD_DIR to a build directory configured with -DENABLE_BENCHMARKS=ON")
+endif()
+
+if(NOT TARGETS)
+    set(TARGETS
+        bench_parse_headers bench_parse_pch bench_parse_module
+        bench_memoize_plain bench_memoize_cached)
+endif()
+
+if(NOT JOBS)
+    cmake_host_system_information(RESULT JOBS QUERY NUMBER_OF_LOGICAL_CORES)
+endif()
+
+foreach(target tmp_module ${TARGETS})
+    # remove the objects, precompiled headers and module interfaces of a previous run
+    file(GLOB_RECURSE outputs
+        ${BUILD_DIR}/CMakeFiles/${target}.dir/*
+        ${BUILD_DIR}/benchmarks/CMakeFiles/${target}.dir/*)
+    list(FILTER outputs INCLUDE REGEX "\\.(o|obj|gch|pch|pcm|gcm|ifc)$")
+    if(outputs)
+        file(REMOVE ${outputs})
+    endif()
+endforeach()
+
+foreach(target ${TARGETS})
+    string(TIMESTAMP start "%s%f" UTC)
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} --build ${BUILD_DIR} --target ${target} --parallel ${JOBS}
+        RESULT_VARIABLE result
+        OUTPUT_QUIET
+        ERROR_QUIET)
+    string(TIMESTAMP stop "%s%f" UTC)
+    if(NOT result EQUAL 0)
+        message(STATUS "${target}: not available")
+        continue()
+    endif()
+    math(EXPR elapsed_ms "(${stop} - ${start}) / 1000")
+    message(STATUS "${target}: ${elapsed_ms} ms")
+endforeach()
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+// Helpers shared by the benchmarks
+
+#include <tmp/Typelist.hpp>
+#include <chrono>
+#include <cstddef>
+#include <utility>
+
+namespace bench {
+
+template<template<typename...> typename LIST, template<std::size_t> typename ELEMENT, std::size_t FIRST, typename SEQUENCE>
+struct make_numbered;
+
+template<template<typename...> typename LIST, template<std::size_t> typename ELEMENT, std::size_t FIRST, std::size_t... INDEXs>
+struct make_numbered<LIST, ELEMENT, FIRST, std::index_sequence<INDEXs...>>
+{
+    using type = LIST<ELEMENT<FIRST + INDEXs>...>;
+};
+
+// LIST<ELEMENT<FIRST>, ELEMENT<FIRST + 1>, ..., ELEMENT<FIRST + COUNT - 1>>, i.e. a typelist or a std::variant of COUNT distinct types
+template<std::size_t COUNT, template<std::size_t> typename ELEMENT, template<typename...> typename LIST = tmp::typelist, std::size_t FIRST = 0U>
+using numbered_t = typename make_numbered<LIST, ELEMENT, FIRST, std::make_index_sequence<COUNT>>::type;
+
+// Calls the function once and returns the wall time in nanoseconds
+template<typename FUNCTION>
+double measure_ns(FUNCTION&& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    std::forward<FUNCTION>(function)();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+} // namespace bench
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Call overhead of isa_dispatch against a direct call of the same kernel.
+// Run with TMP_CPU_LEVEL=scalar|sse4.2|avx2|avx512 to force a level.
+
+#include "common.hpp"
+#include <tmp/IsaDispatch.hpp>
+#include <tmp/Dispatch.hpp>
+#include <array>
+#include <cstddef>
+#include <print>
+#include <type_traits>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define BENCH_TARGET(ISA) __attribute__((target(ISA), noinline))
+#else
+#define BENCH_TARGET(ISA) __attribute__((noinline))
+#endif
+
+namespace {
+
+constexpr std::size_t elements = 16U;
+constexpr std::size_t calls = 20000000U;
+
+template<typename T>
+T sum(const T* values)
+{
+    T result{};
+    for (std::size_t i = 0U; i < elements; ++i) {
+        result += values[i];
+    }
+    return result;
+}
+
+struct avx512_sum
+{
+    static constexpr tmp::cpu_feature required_features = tmp::cpu_feature::avx512f;
+    BENCH_TARGET("avx512f") static float run(const float* values) { return sum(values); }
+};
+
+struct avx2_sum
+{
+    static constexpr tmp::cpu_feature required_features = tmp::cpu_feature::avx2;
+    BENCH_TARGET("avx2") static float run(const float* values) { return sum(values); }
+};
+
+struct sse42_sum
+{
+    static constexpr tmp::cpu_feature required_features = tmp::cpu_feature::sse42;
+    BENCH_TARGET("sse4.2") static float run(const float* values) { return sum(values); }
+};
+
+struct scalar_sum
+{
+    static constexpr tmp::cpu_feature required_features = tmp::cpu_feature::none;
+    BENCH_TARGET("default") static float run(const float* values) { return sum(values); }
+};
+
+using sums = tmp::typelist<avx512_sum, avx2_sum, sse42_sum, scalar_sum>;
+using sum_kernel = tmp::isa_dispatch<sums>;
+
+template<typename FUNCTION>
+void measure(const char* name, FUNCTION&& function)
+{
+    std::array<float, elements> values{};
+    values.fill(1.0F);
+    float total = 0.0F;
+    const double ns = bench::measure_ns([&] {
+        for (std::size_t call = 0U; call < calls; ++call) {
+            values[call % elements] = static_cast<float>(call % 3U);
+            total += function(values.data());
+        }
+    });
+    std::print("{:<24} {:8.3f} ns/call (checksum {})\n", name, ns / static_cast<double>(calls), total);
+}
+
+} // namespace
+
+int main()
+{
+    constexpr std::array<const char*, 4> names = {"avx512", "avx2", "sse4.2", "scalar"};
+    const std::size_t selected = sum_kernel::index_for(tmp::available_cpu_features());
+    std::print("selected implementation: {}\n", names[selected]);
+
+    // the implementation is chosen once, the timed loop calls its run function directly
+    tmp::dispatch<sums>(selected, []<typename T>(std::type_identity<T>) {
+        measure("direct call", [](const float* values) { return T::run(values); });
+    });
+    measure("isa_dispatch::call", [](const float* values) { return sum_kernel::call(values); });
+    measure("isa_dispatch::target()", [target = sum_kernel::target()](const float* values) { return target(values); });
+}
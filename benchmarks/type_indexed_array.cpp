@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Lookup latency of per type values: type_indexed_array against std::unordered_map<std::type_index, V>
+
+#include "common.hpp"
+#include <tmp/TypeIndexed.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <print>
+#include <random>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+template<std::size_t INDEX>
+struct message {};
+
+constexpr std::size_t message_count = 32U;
+constexpr std::size_t rounds = 1000000U;
+
+using messages = bench::numbered_t<message_count, message>;
+
+template<typename FUNCTION>
+void measure(const char* name, std::size_t lookups, FUNCTION&& function)
+{
+    const double ns = bench::measure_ns(std::forward<FUNCTION>(function));
+    std::print("{:<40} {:8.3f} ns/lookup\n", name, ns / static_cast<double>(lookups));
+}
+
+template<std::size_t... INDEXs>
+void run(std::index_sequence<INDEXs...>)
+{
+    tmp::type_indexed_array<messages, std::uint64_t> array;
+    std::unordered_map<std::type_index, std::uint64_t> map;
+    (map.emplace(typeid(message<INDEXs>), 0U), ...);
+
+    std::vector<std::size_t> indices(rounds);
+    std::mt19937 generator{42U};
+    std::uniform_int_distribution<std::size_t> distribution{0U, message_count - 1U};
+    for (auto& index : indices) {
+        index = distribution(generator);
+    }
+    const std::vector<std::type_index> keys{typeid(message<INDEXs>)...};
+
+    measure("type_indexed_array::get<T>", rounds * message_count, [&] {
+        for (std::size_t round = 0; round < rounds; ++round) {
+            ((array.template get<message<INDEXs>>() += round), ...);
+            // keeps the compiler from merging the rounds
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        }
+    });
+    measure("unordered_map::find(typeid(T))", rounds * message_count, [&] {
+        for (std::size_t round = 0; round < rounds; ++round) {
+            ((map.find(typeid(message<INDEXs>))->second += round), ...);
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        }
+    });
+    measure("type_indexed_array::operator[](random)", rounds, [&] {
+        for (std::size_t index : indices) {
+            array[index] += index;
+        }
+    });
+    measure("unordered_map::find(random)", rounds, [&] {
+        for (std::size_t index : indices) {
+            map.find(keys[index])->second += index;
+        }
+    });
+
+    std::uint64_t checksum = 0;
+    for (std::uint64_t value : array) {
+        checksum += value;
+    }
+    for (const auto& [key, value] : map) {
+        checksum -= value;
+    }
+    std::print("checksum {}\n", checksum);
+}
+
+} // namespace
+
+int main()
+{
+    run(std::make_index_sequence<message_count>{});
+}
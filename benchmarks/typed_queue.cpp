@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Throughput of typed_queue against a std::deque of std::variant behind a std::mutex
+
+#include "common.hpp"
+#include <tmp/TypedQueue.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <print>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace {
+
+// messages from 16 to 128 bytes
+template<std::size_t INDEX>
+struct message
+{
+    std::uint64_t sequence;
+    std::uint32_t payload[(INDEX % 8U) * 4U + 2U];
+};
+
+constexpr std::size_t message_count = 30U;
+constexpr std::uint64_t messages_per_producer = 2000000U;
+constexpr std::size_t queue_bytes = 1U << 16U;
+
+using messages = bench::numbered_t<message_count, message>;
+using message_variant = bench::numbered_t<message_count, message, std::variant>;
+
+class mutex_queue
+{
+public:
+    template<typename T>
+    bool emplace(std::uint64_t sequence)
+    {
+        std::lock_guard lock{mutex_};
+        if (queue_.size() * sizeof(message_variant) >= queue_bytes) {
+            return false;
+        }
+        queue_.emplace_back(T{sequence, {}});
+        return true;
+    }
+
+    template<typename VISITOR>
+    std::size_t consume(VISITOR&& visitor)
+    {
+        std::size_t consumed = 0U;
+        std::lock_guard lock{mutex_};
+        for (; !queue_.empty(); queue_.pop_front()) {
+            std::visit(visitor, queue_.front());
+            ++consumed;
+        }
+        return consumed;
+    }
+
+private:
+    std::mutex mutex_;
+    std::deque<message_variant> queue_;
+};
+
+template<typename QUEUE, std::size_t... INDEXs>
+void produce(QUEUE& queue, std::index_sequence<INDEXs...>)
+{
+    std::uint64_t sequence = 0U;
+    while (sequence < messages_per_producer) {
+        // one message of each type per round
+        ([&] {
+            if (sequence < messages_per_producer) {
+                while (!queue.template emplace<message<INDEXs>>(sequence)) {
+                    std::this_thread::yield();
+                }
+                ++sequence;
+            }
+        }(), ...);
+    }
+}
+
+template<typename QUEUE>
+void measure(const char* name, QUEUE& queue, std::size_t producers)
+{
+    std::uint64_t consumed = 0U;
+    std::uint64_t checksum = 0U;
+    const double ns = bench::measure_ns([&] {
+        std::vector<std::thread> threads;
+        for (std::size_t producer = 0U; producer < producers; ++producer) {
+            threads.emplace_back([&queue] { produce(queue, std::make_index_sequence<message_count>{}); });
+        }
+        while (consumed < producers * messages_per_producer) {
+            const std::size_t count = queue.consume([&checksum](const auto& message) { checksum += message.sequence; });
+            if (count == 0U) {
+                std::this_thread::yield();
+            }
+            consumed += count;
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    });
+    const double seconds = ns / 1e9;
+    std::print("{:<32} {:8.2f} M messages/s (checksum {})\n", name, static_cast<double>(consumed) / seconds / 1e6, checksum);
+}
+
+// emplace with the same signature as mutex_queue
+template<typename QUEUE>
+struct sequence_emplacer
+{
+    template<typename T>
+    bool emplace(std::uint64_t sequence)
+    {
+        return queue.template emplace<T>(T{sequence, {}});
+    }
+
+    template<typename VISITOR>
+    std::size_t consume(VISITOR&& visitor)
+    {
+        return queue.consume(std::forward<VISITOR>(visitor));
+    }
+
+    QUEUE queue{queue_bytes};
+};
+
+} // namespace
+
+int main()
+{
+    {
+        sequence_emplacer<tmp::typed_queue<messages>> queue;
+        measure("typed_queue spsc", queue, 1U);
+    }
+    {
+        mutex_queue queue;
+        measure("mutex + deque<variant>, 1 producer", queue, 1U);
+    }
+    for (std::size_t producers : {2U, 4U}) {
+        {
+            sequence_emplacer<tmp::typed_queue<messages, tmp::queue_producers::multiple>> queue;
+            std::print("{} producers\n", producers);
+            measure("typed_queue mpsc", queue, producers);
+        }
+        {
+            mutex_queue queue;
+            measure("mutex + deque<variant>", queue, producers);
+        }
+    }
+}
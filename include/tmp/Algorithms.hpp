@@ -7,10 +7,43 @@
 #pragma once
 
 #include "Typelist.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <type_traits>
+#include <utility>
 
 namespace tmp {
 
+namespace internal {
+
+template<typename RESULT>
+struct memoized_result
+{
+    using type = std::type_identity<typename RESULT::type>;
+};
+
+template<typename RESULT>
+    requires requires { RESULT::value; }
+struct memoized_result<RESULT>
+{
+    using type = std::integral_constant<std::remove_cv_t<decltype(RESULT::value)>, RESULT::value>;
+};
+
+} // namespace internal
+
+// Adaptor for predicates, keys, comparators and operations passed to the algorithms: memoize<F>::template fn.
+// fn<Ts...> is a std::integral_constant with the value of F<Ts...>::value, or a std::type_identity of F<Ts...>::type,
+// so traits with the same result map to the same canonical type.
+// It does not make F<Ts...> cheaper to compile, the compiler already instantiates every specialization only once.
+template<template<typename...> typename FUNCTION>
+struct memoize
+{
+    template<typename... Ts>
+    using fn = typename internal::memoized_result<FUNCTION<Ts...>>::type;
+};
+
 // is the true type if for all of the elements the predicate has a value of true
 template<concepts::typelist LIST,  template<typename> typename PREDICATE>
 struct all_of;
@@ -176,6 +209,65 @@ struct remove_if<typelist<FIRST, RESTs...>, PREDICATE>
 };
 
 
+namespace internal {
+
+template<bool MATCH, typename T, concepts::typelist MATCHING, concepts::typelist REST>
+struct partition_step;
+
+template<typename T, concepts::typelist MATCHING, concepts::typelist REST>
+struct partition_step<true, T, MATCHING, REST>
+{
+    using matching = append_t<T, MATCHING>;
+    using rest = REST;
+};
+
+template<typename T, concepts::typelist MATCHING, concepts::typelist REST>
+struct partition_step<false, T, MATCHING, REST>
+{
+    using matching = MATCHING;
+    using rest = append_t<T, REST>;
+};
+
+template<template<typename> typename PREDICATE, concepts::typelist MATCHING, concepts::typelist REST, typename... ELEMENTs>
+struct partition_helper
+{
+    using type = typelist<MATCHING, REST>;
+};
+
+template<template<typename> typename PREDICATE, concepts::typelist MATCHING, concepts::typelist REST, typename FIRST, typename... RESTs>
+struct partition_helper<PREDICATE, MATCHING, REST, FIRST, RESTs...>
+{
+    using step = partition_step<PREDICATE<FIRST>::value, FIRST, MATCHING, REST>;
+    using type = typename partition_helper<PREDICATE, typename step::matching, typename step::rest, RESTs...>::type;
+};
+
+} // namespace internal
+
+// type is a typelist of two typelists: the elements that satisfies the predicate and the elements that do not.
+// Both keep the order of the list. The predicate is evaluated once per element.
+template<concepts::typelist LIST, template<typename> typename PREDICATE>
+struct partition;
+
+template<concepts::typelist LIST, template<typename> typename PREDICATE>
+using partition_t = typename partition<LIST, PREDICATE>::type;
+
+template<template<typename> typename PREDICATE, typename... ELEMENTs>
+struct partition<typelist<ELEMENTs...>, PREDICATE>
+{
+    using type = typename internal::partition_helper<PREDICATE, typelist<>, typelist<>, ELEMENTs...>::type;
+};
+
+// type is the list with the elements that satisfies the predicate first. The order within both parts is kept.
+template<concepts::typelist LIST, template<typename> typename PREDICATE>
+struct stable_partition
+{
+    using type = concat_t<front_t<partition_t<LIST, PREDICATE>>, back_t<partition_t<LIST, PREDICATE>>>;
+};
+
+template<concepts::typelist LIST, template<typename> typename PREDICATE>
+using stable_partition_t = typename stable_partition<LIST, PREDICATE>::type;
+
+
 // removes the firs occurrences of a type if there exist the same type later in the list
 template<concepts::typelist LIST>
 struct unique_keep_last;
@@ -227,6 +319,212 @@ struct transform<typelist<ELEMENTs...>, OPERATION>
 };
 
 
+namespace internal {
+
+template<auto KEY, concepts::typelist LIST>
+struct group {};
+
+// adds T to the group with KEY, or appends a new group if there is none
+template<auto KEY, typename T, concepts::typelist GROUPS>
+struct group_insert;
+
+template<auto KEY, typename T, concepts::typelist GROUPS>
+using group_insert_t = typename group_insert<KEY, T, GROUPS>::type;
+
+template<auto KEY, typename T>
+struct group_insert<KEY, T, typelist<>>
+{
+    using type = typelist<group<KEY, typelist<T>>>;
+};
+
+template<auto KEY, typename T, typename... ELEMENTs, typename... RESTs>
+struct group_insert<KEY, T, typelist<group<KEY, typelist<ELEMENTs...>>, RESTs...>>
+{
+    using type = typelist<group<KEY, typelist<ELEMENTs..., T>>, RESTs...>;
+};
+
+template<auto KEY, typename T, typename FIRST, typename... RESTs>
+struct group_insert<KEY, T, typelist<FIRST, RESTs...>>
+{
+    using type = prepend_t<FIRST, group_insert_t<KEY, T, typelist<RESTs...>>>;
+};
+
+template<template<typename> typename KEY, concepts::typelist GROUPS, typename... ELEMENTs>
+struct group_by_helper
+{
+    using type = GROUPS;
+};
+
+template<template<typename> typename KEY, concepts::typelist GROUPS, typename FIRST, typename... RESTs>
+struct group_by_helper<KEY, GROUPS, FIRST, RESTs...>
+{
+    using type = typename group_by_helper<KEY, group_insert_t<KEY<FIRST>::value, FIRST, GROUPS>, RESTs...>::type;
+};
+
+template<typename GROUP>
+struct group_elements;
+
+template<auto KEY, concepts::typelist LIST>
+struct group_elements<group<KEY, LIST>>
+{
+    using type = LIST;
+};
+
+} // namespace internal
+
+// type is a typelist of typelists, one for each distinct KEY<T>::value.
+// The groups are ordered by the first occurrence of their key, the elements within a group keep the order of the list.
+// The key is evaluated once per element.
+template<concepts::typelist LIST, template<typename> typename KEY>
+struct group_by;
+
+template<concepts::typelist LIST, template<typename> typename KEY>
+using group_by_t = typename group_by<LIST, KEY>::type;
+
+template<template<typename> typename KEY, typename... ELEMENTs>
+struct group_by<typelist<ELEMENTs...>, KEY>
+{
+    using type = transform_t<typename internal::group_by_helper<KEY, typelist<>, ELEMENTs...>::type, internal::group_elements>;
+};
+
+
+namespace internal {
+
+template<std::size_t INDEX, typename T>
+struct indexed_element
+{
+    using type = T;
+};
+
+template<typename SEQUENCE, typename... ELEMENTs>
+struct indexed_elements;
+
+template<std::size_t... INDEXs, typename... ELEMENTs>
+struct indexed_elements<std::index_sequence<INDEXs...>, ELEMENTs...> : indexed_element<INDEXs, ELEMENTs>... {};
+
+template<std::size_t INDEX, typename T>
+indexed_element<INDEX, T> select_element(const indexed_element<INDEX, T>&);
+
+// Same as at, but selects the element by overload resolution instead of recursion, so the instantiation depth does not grow with the index
+template<std::size_t INDEX, concepts::typelist LIST>
+struct flat_at;
+
+template<std::size_t INDEX, concepts::typelist LIST>
+using flat_at_t = typename flat_at<INDEX, LIST>::type;
+
+template<std::size_t INDEX, typename... ELEMENTs>
+struct flat_at<INDEX, typelist<ELEMENTs...>>
+{
+    static_assert(INDEX < sizeof...(ELEMENTs));
+    using type = typename decltype(select_element<INDEX>(std::declval<const indexed_elements<std::index_sequence_for<ELEMENTs...>, ELEMENTs...>&>()))::type;
+};
+
+// index into the list number dimension of the element index of a cartesian product, the last list changes fastest
+template<std::size_t... COUNTs>
+constexpr std::size_t product_coordinate(std::size_t index, std::size_t dimension)
+{
+    constexpr std::array<std::size_t, sizeof...(COUNTs)> counts = {COUNTs...};
+    for (std::size_t i = counts.size(); i > dimension + 1U; --i) {
+        index /= counts[i - 1U];
+    }
+    return index % counts[dimension];
+}
+
+template<std::size_t INDEX, typename DIMENSIONS, concepts::typelist... LISTs>
+struct product_element;
+
+template<std::size_t INDEX, std::size_t... DIMENSIONs, concepts::typelist... LISTs>
+struct product_element<INDEX, std::index_sequence<DIMENSIONs...>, LISTs...>
+{
+    using type = typelist<flat_at_t<product_coordinate<count_v<LISTs>...>(INDEX, DIMENSIONs), LISTs>...>;
+};
+
+template<typename SEQUENCE, concepts::typelist... LISTs>
+struct product_helper;
+
+template<std::size_t... INDEXs, concepts::typelist... LISTs>
+struct product_helper<std::index_sequence<INDEXs...>, LISTs...>
+{
+    using type = typelist<typename product_element<INDEXs, std::index_sequence_for<LISTs...>, LISTs...>::type...>;
+};
+
+constexpr std::size_t binomial(std::size_t n, std::size_t k)
+{
+    if (k > n) {
+        return 0U;
+    }
+    if (k > n - k) {
+        k = n - k;
+    }
+    std::size_t result = 1U;
+    for (std::size_t i = 1U; i <= k; ++i) {
+        result = result * (n - k + i) / i;
+    }
+    return result;
+}
+
+// indices of the combination number rank in lexicographical order
+template<std::size_t N, std::size_t K>
+constexpr std::array<std::size_t, K> combination_indices(std::size_t rank)
+{
+    std::array<std::size_t, K> indices{};
+    std::size_t candidate = 0U;
+    for (std::size_t slot = 0U; slot < K; ++slot, ++candidate) {
+        while (rank >= binomial(N - candidate - 1U, K - slot - 1U)) {
+            rank -= binomial(N - candidate - 1U, K - slot - 1U);
+            ++candidate;
+        }
+        indices[slot] = candidate;
+    }
+    return indices;
+}
+
+template<concepts::typelist LIST, std::size_t K, std::size_t RANK, typename SLOTS = std::make_index_sequence<K>>
+struct combination_element;
+
+template<concepts::typelist LIST, std::size_t K, std::size_t RANK, std::size_t... SLOTs>
+struct combination_element<LIST, K, RANK, std::index_sequence<SLOTs...>>
+{
+    using type = typelist<flat_at_t<combination_indices<count_v<LIST>, K>(RANK)[SLOTs], LIST>...>;
+};
+
+template<concepts::typelist LIST, std::size_t K, typename SEQUENCE>
+struct combinations_helper;
+
+template<concepts::typelist LIST, std::size_t K, std::size_t... RANKs>
+struct combinations_helper<LIST, K, std::index_sequence<RANKs...>>
+{
+    using type = typelist<typename combination_element<LIST, K, RANKs>::type...>;
+};
+
+} // namespace internal
+
+// type is the cartesian product of the lists, a typelist of typelists with one element of each list.
+// The order is lexicographical, the last list changes fastest.
+// All tuples are made in a single pack expansion, the instantiation depth does not depend on the length of the lists.
+template<concepts::typelist... LISTs>
+struct product
+{
+    static constexpr std::size_t size = (count_v<LISTs> * ... * std::size_t{1U});
+    using type = typename internal::product_helper<std::make_index_sequence<size>, LISTs...>::type;
+};
+
+template<concepts::typelist... LISTs>
+using product_t = typename product<LISTs...>::type;
+
+// type is a typelist of all typelists with K elements of the list, keeping the order of the list.
+// The combinations are ordered lexicographically by the indices of their elements.
+template<concepts::typelist LIST, std::size_t K>
+struct combinations
+{
+    static constexpr std::size_t size = internal::binomial(count_v<LIST>, K);
+    using type = typename internal::combinations_helper<LIST, K, std::make_index_sequence<size>>::type;
+};
+
+template<concepts::typelist LIST, std::size_t K>
+using combinations_t = typename combinations<LIST, K>::type;
+
+
 namespace internal {
 
 template<typename T, concepts::typelist LIST, template<typename> typename PREDICATE, concepts::typelist FRONT = typelist<>>
@@ -309,4 +607,37 @@ struct lt_size
 template<typename T1, typename T2>
 inline constexpr bool lt_size_v = lt_size<T1, T2>::value;
 
+template<typename T1, typename T2>
+struct gt_align
+{
+    using type = bool;
+    static constexpr type value = alignof(T1) > alignof(T2);
+};
+
+template<typename T1, typename T2>
+inline constexpr bool gt_align_v = gt_align<T1, T2>::value;
+
+template<typename T1, typename T2>
+struct lt_align
+{
+    using type = bool;
+    static constexpr type value = alignof(T1) < alignof(T2);
+};
+
+template<typename T1, typename T2>
+inline constexpr bool lt_align_v = lt_align<T1, T2>::value;
+
+// type is the smallest unsigned integer type that can hold VALUE
+template<std::uintmax_t VALUE>
+struct smallest_unsigned
+{
+    template<typename T>
+    struct can_hold : std::bool_constant<VALUE <= std::numeric_limits<T>::max()> {};
+
+    using type = find_if_t<typelist<std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t>, can_hold>;
+};
+
+template<std::uintmax_t VALUE>
+using smallest_unsigned_t = typename smallest_unsigned<VALUE>::type;
+
 } // namespace tmp
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "Typelist.hpp"
+#include "Algorithms.hpp"
+#include "Dispatch.hpp"
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace tmp {
+
+namespace internal {
+
+// emplace of a copy either copies without throwing, or copies first and then moves without throwing
+template<typename T>
+struct is_emplace_copyable : std::bool_constant<std::is_nothrow_copy_constructible_v<T> || std::is_nothrow_move_constructible_v<T>> {};
+
+} // namespace internal
+
+// A variant over the elements of a typelist.
+// The storage is as large as the largest element and the index is the smallest unsigned type that can hold count_v<LIST>.
+// If all elements are trivially copyable, the variant is trivially copyable and destructible as well.
+// visit is a single jump through a table, see dispatch.
+template<concepts::typelist LIST>
+class compact_variant
+{
+    static_assert(count_v<LIST> > 0U, "a variant needs at least one alternative");
+    static_assert(count_v<unique_t<LIST>> == count_v<LIST>, "the alternatives must be unique");
+    static_assert(all_of_v<LIST, std::is_object>, "the alternatives must be object types");
+    static_assert(all_of_v<LIST, std::is_nothrow_destructible>, "the alternatives must be nothrow destructible");
+
+public:
+    using types = LIST;
+    using index_type = smallest_unsigned_t<count_v<LIST>>;
+
+    static constexpr bool is_trivial = all_of_v<LIST, std::is_trivially_copyable>;
+
+    // holds a value initialized first alternative
+    compact_variant() noexcept(std::is_nothrow_default_constructible_v<front_t<LIST>>)
+        requires std::is_default_constructible_v<front_t<LIST>>
+    {
+        construct<front_t<LIST>>();
+    }
+
+    template<typename T>
+        requires has_a_v<LIST, std::remove_cvref_t<T>>
+    compact_variant(T&& value) noexcept(std::is_nothrow_constructible_v<std::remove_cvref_t<T>, T&&>)
+    {
+        construct<std::remove_cvref_t<T>>(std::forward<T>(value));
+    }
+
+    template<typename T, typename... ARGs>
+        requires has_a_v<LIST, T>
+    explicit compact_variant(std::in_place_type_t<T>, ARGs&&... args) noexcept(std::is_nothrow_constructible_v<T, ARGs&&...>)
+    {
+        construct<T>(std::forward<ARGs>(args)...);
+    }
+
+    compact_variant(const compact_variant&) requires is_trivial = default;
+
+    compact_variant(const compact_variant& other) requires (!is_trivial && all_of_v<LIST, std::is_copy_constructible>)
+    {
+        other.visit([this]<typename T>(const T& value) { construct<T>(value); });
+    }
+
+    compact_variant(compact_variant&&) requires is_trivial = default;
+
+    compact_variant(compact_variant&& other) noexcept(all_of_v<LIST, std::is_nothrow_move_constructible>)
+        requires (!is_trivial && all_of_v<LIST, std::is_move_constructible>)
+    {
+        other.visit([this]<typename T>(T& value) { construct<T>(std::move(value)); });
+    }
+
+    compact_variant& operator=(const compact_variant&) requires is_trivial = default;
+
+    // assignment replaces the value with emplace, so it needs the alternatives that emplace can replace without losing the old value
+    compact_variant& operator=(const compact_variant& other)
+        requires (!is_trivial && all_of_v<LIST, std::is_copy_constructible> && all_of_v<LIST, internal::is_emplace_copyable>)
+    {
+        if (this != &other) {
+            other.visit([this]<typename T>(const T& value) { emplace<T>(value); });
+        }
+        return *this;
+    }
+
+    compact_variant& operator=(compact_variant&&) requires is_trivial = default;
+
+    compact_variant& operator=(compact_variant&& other) noexcept
+        requires (!is_trivial && all_of_v<LIST, std::is_nothrow_move_constructible>)
+    {
+        if (this != &other) {
+            other.visit([this]<typename T>(T& value) { emplace<T>(std::move(value)); });
+        }
+        return *this;
+    }
+
+    ~compact_variant() requires is_trivial = default;
+
+    ~compact_variant()
+    {
+        destroy();
+    }
+
+    // Replaces the held value by a T constructed from args.
+    // If constructing T may throw, it is constructed before the old value is destroyed, so the variant never holds a destroyed value.
+    template<typename T, typename... ARGs>
+        requires has_a_v<LIST, T>
+    T& emplace(ARGs&&... args)
+    {
+        if constexpr (std::is_nothrow_constructible_v<T, ARGs&&...>) {
+            destroy();
+            return construct<T>(std::forward<ARGs>(args)...);
+        } else {
+            static_assert(std::is_nothrow_move_constructible_v<T>, "T must be nothrow constructible from args or nothrow move constructible");
+            T value(std::forward<ARGs>(args)...);
+            destroy();
+            return construct<T>(std::move(value));
+        }
+    }
+
+    std::size_t index() const noexcept
+    {
+        return index_;
+    }
+
+    template<typename T>
+    bool holds_alternative() const noexcept
+    {
+        return index_ == index_of_v<T, LIST>;
+    }
+
+    template<typename T>
+    T* get_if() noexcept
+    {
+        return holds_alternative<T>() ? pointer<T>() : nullptr;
+    }
+
+    template<typename T>
+    const T* get_if() const noexcept
+    {
+        return holds_alternative<T>() ? pointer<T>() : nullptr;
+    }
+
+    // The variant must hold a T
+    template<typename T>
+    T& get() noexcept
+    {
+        assert(holds_alternative<T>());
+        return *pointer<T>();
+    }
+
+    template<typename T>
+    const T& get() const noexcept
+    {
+        assert(holds_alternative<T>());
+        return *pointer<T>();
+    }
+
+    // Calls the visitor with a reference to the held value.
+    // The visitor must return the same type for all alternatives.
+    template<typename VISITOR>
+    decltype(auto) visit(VISITOR&& visitor)
+    {
+        return dispatch<LIST>(index_, [this, &visitor]<typename T>(std::type_identity<T>) -> decltype(auto) {
+            return std::forward<VISITOR>(visitor)(*pointer<T>());
+        });
+    }
+
+    template<typename VISITOR>
+    decltype(auto) visit(VISITOR&& visitor) const
+    {
+        return dispatch<LIST>(index_, [this, &visitor]<typename T>(std::type_identity<T>) -> decltype(auto) {
+            return std::forward<VISITOR>(visitor)(*pointer<T>());
+        });
+    }
+
+private:
+    template<typename T>
+    T* pointer() noexcept
+    {
+        return std::launder(reinterpret_cast<T*>(storage_));
+    }
+
+    template<typename T>
+    const T* pointer() const noexcept
+    {
+        return std::launder(reinterpret_cast<const T*>(storage_));
+    }
+
+    template<typename T, typename... ARGs>
+    T& construct(ARGs&&... args)
+    {
+        T* value = ::new (static_cast<void*>(storage_)) T(std::forward<ARGs>(args)...);
+        index_ = static_cast<index_type>(index_of_v<T, LIST>);
+        return *value;
+    }
+
+    void destroy() noexcept
+    {
+        if constexpr (!all_of_v<LIST, std::is_trivially_destructible>) {
+            visit([]<typename T>(T& value) { std::destroy_at(&value); });
+        }
+    }
+
+    alignas(alignof(max_t<LIST, gt_align>)) std::byte storage_[sizeof(max_t<LIST, gt_size>)];
+    index_type index_;
+};
+
+} // namespace tmp
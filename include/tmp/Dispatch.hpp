@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "Typelist.hpp"
+#include "Algorithms.hpp"
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tmp {
+
+namespace internal {
+
+// A table with one function pointer per element of the list.
+// Entry i calls the function with std::type_identity of the i-th element.
+template<concepts::typelist LIST, typename FUNCTION>
+struct jump_table;
+
+template<typename FUNCTION, typename FIRST, typename... RESTs>
+struct jump_table<typelist<FIRST, RESTs...>, FUNCTION>
+{
+    using result_type = std::invoke_result_t<FUNCTION, std::type_identity<FIRST>>;
+
+    static_assert(std::conjunction_v<std::is_same<result_type, std::invoke_result_t<FUNCTION, std::type_identity<RESTs>>>...>,
+                  "the function must return the same type for all elements");
+
+    using entry_type = result_type (*)(FUNCTION&&);
+
+    template<typename ELEMENT>
+    static constexpr result_type call(FUNCTION&& function)
+    {
+        return std::forward<FUNCTION>(function)(std::type_identity<ELEMENT>{});
+    }
+
+    static constexpr std::array<entry_type, 1U + sizeof...(RESTs)> entries = {&call<FIRST>, &call<RESTs>...};
+};
+
+// A table with one function pointer per pair of elements of two lists, stored row by row.
+// Entry i * count_v<LIST2> + j calls the function with std::type_identity of the i-th element of LIST1 and the j-th element of LIST2.
+template<concepts::typelist LIST1, concepts::typelist LIST2, typename FUNCTION, concepts::typelist PAIRS = product_t<LIST1, LIST2>>
+struct jump_table2;
+
+template<typename FIRST1, typename... REST1s, typename FIRST2, typename... REST2s, typename FUNCTION, typename... PAIRs>
+struct jump_table2<typelist<FIRST1, REST1s...>, typelist<FIRST2, REST2s...>, FUNCTION, typelist<PAIRs...>>
+{
+    using result_type = std::invoke_result_t<FUNCTION, std::type_identity<FIRST1>, std::type_identity<FIRST2>>;
+    using entry_type = result_type (*)(FUNCTION&&);
+
+    template<typename PAIR>
+    struct entry;
+
+    template<typename ELEMENT1, typename ELEMENT2>
+    struct entry<typelist<ELEMENT1, ELEMENT2>>
+    {
+        static_assert(std::is_same_v<result_type, std::invoke_result_t<FUNCTION, std::type_identity<ELEMENT1>, std::type_identity<ELEMENT2>>>,
+                      "the function must return the same type for all pairs of elements");
+
+        static constexpr result_type call(FUNCTION&& function)
+        {
+            return std::forward<FUNCTION>(function)(std::type_identity<ELEMENT1>{}, std::type_identity<ELEMENT2>{});
+        }
+    };
+
+    static constexpr std::array<entry_type, sizeof...(PAIRs)> entries = {&entry<PAIRs>::call...};
+};
+
+} // namespace internal
+
+// Calls the function with std::type_identity of the element at index in the list.
+// The call is a single indirect jump, independent of the length of the list.
+// The index must be less than count_v<LIST>
+template<concepts::typelist LIST, typename FUNCTION>
+constexpr decltype(auto) dispatch(std::size_t index, FUNCTION&& function)
+{
+    static_assert(count_v<LIST> > 0U, "cannot dispatch over an empty list");
+    return internal::jump_table<LIST, FUNCTION>::entries[index](std::forward<FUNCTION>(function));
+}
+
+// Calls the function with std::type_identity of the element at index1 in LIST1 and the element at index2 in LIST2.
+// All pairs are in one flat table, the call is a single indirect jump.
+// The indices must be less than count_v<LIST1> and count_v<LIST2>
+template<concepts::typelist LIST1, concepts::typelist LIST2, typename FUNCTION>
+constexpr decltype(auto) dispatch2(std::size_t index1, std::size_t index2, FUNCTION&& function)
+{
+    static_assert(count_v<LIST1> > 0U && count_v<LIST2> > 0U, "cannot dispatch over an empty list");
+    return internal::jump_table2<LIST1, LIST2, FUNCTION>::entries[index1 * count_v<LIST2> + index2](std::forward<FUNCTION>(function));
+}
+
+} // namespace tmp
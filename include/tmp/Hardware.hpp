@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <cpuid.h>
+#endif
+
+namespace tmp {
+
+// Alignment that keeps data written by different threads on different cache lines.
+// std::hardware_destructive_interference_size is not used, its value may differ between compiler flags and would change the layout.
+inline constexpr std::size_t cache_line_size = 64U;
+
+// Instruction set extensions, as a bitmask
+enum class cpu_feature : std::uint32_t
+{
+    none = 0U,
+    sse42 = 1U << 0U,
+    popcnt = 1U << 1U,
+    avx = 1U << 2U,
+    avx2 = 1U << 3U,
+    fma = 1U << 4U,
+    bmi1 = 1U << 5U,
+    bmi2 = 1U << 6U,
+    avx512f = 1U << 7U,
+    avx512dq = 1U << 8U,
+    avx512cd = 1U << 9U,
+    avx512bw = 1U << 10U,
+    avx512vl = 1U << 11U,
+    all = (1U << 12U) - 1U,
+};
+
+constexpr cpu_feature operator|(cpu_feature lhs, cpu_feature rhs) noexcept
+{
+    return static_cast<cpu_feature>(static_cast<std::uint32_t>(lhs) | static_cast<std::uint32_t>(rhs));
+}
+
+constexpr cpu_feature operator&(cpu_feature lhs, cpu_feature rhs) noexcept
+{
+    return static_cast<cpu_feature>(static_cast<std::uint32_t>(lhs) & static_cast<std::uint32_t>(rhs));
+}
+
+// true if all features of required are in available
+constexpr bool has_cpu_features(cpu_feature available, cpu_feature required) noexcept
+{
+    return (available & required) == required;
+}
+
+// The x86-64 micro architecture levels of the psABI, restricted to the features above
+inline constexpr cpu_feature x86_64_v2 = cpu_feature::sse42 | cpu_feature::popcnt;
+inline constexpr cpu_feature x86_64_v3 = x86_64_v2 | cpu_feature::avx | cpu_feature::avx2 | cpu_feature::fma | cpu_feature::bmi1 | cpu_feature::bmi2;
+inline constexpr cpu_feature x86_64_v4 = x86_64_v3 | cpu_feature::avx512f | cpu_feature::avx512dq | cpu_feature::avx512cd | cpu_feature::avx512bw | cpu_feature::avx512vl;
+
+// The features of a level by name, as used by the TMP_CPU_LEVEL environment variable.
+// An unknown name does not restrict the features.
+constexpr cpu_feature cpu_feature_level(std::string_view name) noexcept
+{
+    if (name == "scalar") {
+        return cpu_feature::none;
+    }
+    if (name == "sse4.2" || name == "x86-64-v2") {
+        return x86_64_v2;
+    }
+    if (name == "avx2" || name == "x86-64-v3") {
+        return x86_64_v3;
+    }
+    if (name == "avx512" || name == "x86-64-v4") {
+        return x86_64_v4;
+    }
+    return cpu_feature::all;
+}
+
+// The features of the cpu that are also enabled by the operating system
+inline cpu_feature detect_cpu_features() noexcept
+{
+    cpu_feature features = cpu_feature::none;
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    unsigned int eax = 0U;
+    unsigned int ebx = 0U;
+    unsigned int ecx = 0U;
+    unsigned int edx = 0U;
+    if (__get_cpuid(1U, &eax, &ebx, &ecx, &edx) == 0) {
+        return features;
+    }
+    const auto add_if = [&features](bool present, cpu_feature feature) {
+        if (present) {
+            features = features | feature;
+        }
+    };
+    add_if((ecx & (1U << 20U)) != 0U, cpu_feature::sse42);
+    add_if((ecx & (1U << 23U)) != 0U, cpu_feature::popcnt);
+
+    // the AVX registers must be saved by the operating system
+    std::uint64_t xcr0 = 0U;
+    if ((ecx & (1U << 27U)) != 0U) {
+        unsigned int xcr0_low = 0U;
+        unsigned int xcr0_high = 0U;
+        __asm__("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0U));
+        xcr0 = (std::uint64_t{xcr0_high} << 32U) | xcr0_low;
+    }
+    const bool avx_state = (xcr0 & 0x06U) == 0x06U;
+    const bool avx512_state = (xcr0 & 0xE6U) == 0xE6U;
+    add_if(avx_state && (ecx & (1U << 28U)) != 0U, cpu_feature::avx);
+    add_if(avx_state && (ecx & (1U << 12U)) != 0U, cpu_feature::fma);
+
+    if (__get_cpuid_count(7U, 0U, &eax, &ebx, &ecx, &edx) != 0) {
+        add_if((ebx & (1U << 3U)) != 0U, cpu_feature::bmi1);
+        add_if(avx_state && (ebx & (1U << 5U)) != 0U, cpu_feature::avx2);
+        add_if((ebx & (1U << 8U)) != 0U, cpu_feature::bmi2);
+        add_if(avx512_state && (ebx & (1U << 16U)) != 0U, cpu_feature::avx512f);
+        add_if(avx512_state && (ebx & (1U << 17U)) != 0U, cpu_feature::avx512dq);
+        add_if(avx512_state && (ebx & (1U << 28U)) != 0U, cpu_feature::avx512cd);
+        add_if(avx512_state && (ebx & (1U << 30U)) != 0U, cpu_feature::avx512bw);
+        add_if(avx512_state && (ebx & (1U << 31U)) != 0U, cpu_feature::avx512vl);
+    }
+#endif
+    return features;
+}
+
+// The detected features, limited to the level in the TMP_CPU_LEVEL environment variable if it is set.
+// Detected once per process.
+inline cpu_feature available_cpu_features() noexcept
+{
+    static const cpu_feature features = [] {
+        const char* level = std::getenv("TMP_CPU_LEVEL");
+        return detect_cpu_features() & (level != nullptr ? cpu_feature_level(level) : cpu_feature::all);
+    }();
+    return features;
+}
+
+} // namespace tmp
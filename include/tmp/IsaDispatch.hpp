@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "Typelist.hpp"
+#include "Algorithms.hpp"
+#include "Hardware.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tmp {
+
+namespace internal {
+
+// A function pointer that is bound by SELECTOR::select() on the first call.
+// Until then it points to resolve, which binds it and forwards the call. Afterwards calls go directly to the bound function.
+template<typename POINTER, typename SELECTOR>
+class lazy_binding;
+
+template<typename RESULT, typename... ARGs, typename SELECTOR>
+class lazy_binding<RESULT (*)(ARGs...), SELECTOR>
+{
+public:
+    using pointer_type = RESULT (*)(ARGs...);
+
+    static RESULT call(ARGs... args)
+    {
+        return target_.load(std::memory_order_relaxed)(std::forward<ARGs>(args)...);
+    }
+
+    // The bound function, binds it if this is the first use
+    static pointer_type target() noexcept
+    {
+        pointer_type target = target_.load(std::memory_order_relaxed);
+        if (target == &resolve) {
+            // threads racing here all select the same function
+            target = SELECTOR::select();
+            target_.store(target, std::memory_order_relaxed);
+        }
+        return target;
+    }
+
+private:
+    static RESULT resolve(ARGs... args)
+    {
+        return target()(std::forward<ARGs>(args)...);
+    }
+
+    static inline std::atomic<pointer_type> target_{&resolve};
+};
+
+} // namespace internal
+
+// Calls the static run function of the first implementation in the list whose required_features are supported by the cpu.
+// Every implementation declares
+//     static constexpr cpu_feature required_features = ...;
+//     static RESULT run(ARGs...);
+// with the same signature. The list is ordered from the best to the most portable implementation,
+// the last one must not require any feature. The features are checked once, on the first call.
+// The level can be limited with the TMP_CPU_LEVEL environment variable, see available_cpu_features.
+template<concepts::typelist LIST>
+class isa_dispatch;
+
+template<typename... IMPLEMENTATIONs>
+class isa_dispatch<typelist<IMPLEMENTATIONs...>>
+    : public internal::lazy_binding<decltype(&front_t<typelist<IMPLEMENTATIONs...>>::run), isa_dispatch<typelist<IMPLEMENTATIONs...>>>
+{
+    using pointer_type = decltype(&front_t<typelist<IMPLEMENTATIONs...>>::run);
+
+    static_assert(std::conjunction_v<std::is_same<pointer_type, decltype(&IMPLEMENTATIONs::run)>...>,
+                  "all implementations must have a static run function with the same signature");
+    static_assert(back_t<typelist<IMPLEMENTATIONs...>>::required_features == cpu_feature::none,
+                  "the last implementation must not require any cpu feature");
+
+    static constexpr std::array<cpu_feature, sizeof...(IMPLEMENTATIONs)> required_features = {IMPLEMENTATIONs::required_features...};
+    static constexpr std::array<pointer_type, sizeof...(IMPLEMENTATIONs)> implementations = {&IMPLEMENTATIONs::run...};
+
+public:
+    // index of the implementation that is used if the features are available
+    static constexpr std::size_t index_for(cpu_feature available) noexcept
+    {
+        std::size_t index = 0U;
+        while (!has_cpu_features(available, required_features[index])) {
+            ++index;
+        }
+        return index;
+    }
+
+    static pointer_type select() noexcept
+    {
+        return implementations[index_for(available_cpu_features())];
+    }
+};
+
+} // namespace tmp
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "Typelist.hpp"
+#include "Hardware.hpp"
+#include "TypeIndexed.hpp"
+#include "TypeName.hpp"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace tmp {
+
+namespace internal {
+
+// Slots of the running threads, a set bit is a slot in use
+inline constexpr std::size_t max_thread_slots = 1024U;
+inline std::array<std::atomic<std::uint64_t>, max_thread_slots / 64U> used_thread_slots{};
+
+// The smallest free slot, or max_thread_slots if all are in use
+inline std::size_t acquire_thread_slot() noexcept
+{
+    for (std::size_t word = 0U; word < used_thread_slots.size(); ++word) {
+        std::uint64_t used = used_thread_slots[word].load(std::memory_order_relaxed);
+        while (used != ~std::uint64_t{0U}) {
+            const std::uint64_t bit = std::uint64_t{1U} << std::countr_one(used);
+            if (used_thread_slots[word].compare_exchange_weak(used, used | bit, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return word * 64U + static_cast<std::size_t>(std::countr_zero(bit));
+            }
+        }
+    }
+    return max_thread_slots;
+}
+
+// release and acquire order the adds of the exited thread before the adds of the next thread with the slot
+inline void release_thread_slot(std::size_t slot) noexcept
+{
+    if (slot < max_thread_slots) {
+        used_thread_slots[slot / 64U].fetch_and(~(std::uint64_t{1U} << (slot % 64U)), std::memory_order_release);
+    }
+}
+
+// Holds the slot of a thread until the thread exits.
+// The slot itself is a trivially destructible thread_local, so it can still be read after the owner is destroyed.
+class thread_slot_owner
+{
+public:
+    explicit thread_slot_owner(std::size_t& slot) noexcept : slot_{slot}
+    {
+        slot_ = acquire_thread_slot();
+    }
+
+    thread_slot_owner(const thread_slot_owner&) = delete;
+    thread_slot_owner& operator=(const thread_slot_owner&) = delete;
+
+    ~thread_slot_owner()
+    {
+        release_thread_slot(slot_);
+        slot_ = max_thread_slots;
+    }
+
+private:
+    std::size_t& slot_;
+};
+
+// A number per thread, the smallest one that is not used by a running thread.
+// A thread that exits returns its number, so recreated threads get the low numbers again.
+// Once returned, i.e. in the destructor of a thread_local destroyed after the owner, the number is max_thread_slots.
+inline std::size_t thread_slot() noexcept
+{
+    thread_local std::size_t slot = max_thread_slots;
+    thread_local const thread_slot_owner owner{slot};
+    return slot;
+}
+
+} // namespace internal
+
+// COUNTERS counters per element of the list (i.e. received, dropped, latency buckets), sharded per thread.
+// Every thread writes to its own cache line aligned shard, laid out by index_of_v<T, LIST>.
+// A counter is only written by one thread, so add is a relaxed load and store without a locked instruction.
+// The first SHARDS running threads get their own shard, all further threads share one shard with atomic adds.
+// A shard is taken over by a new thread when its thread exits, the counts of the exited thread stay in the shard.
+// Adds of an exiting thread after its shard was returned (i.e. from the destructor of a thread_local) go to the shared shard.
+// snapshot can be called from any thread at any time, it sums up all shards with relaxed loads.
+template<concepts::typelist LIST, std::size_t COUNTERS = 1U, std::size_t SHARDS = 64U>
+class per_type_stats
+{
+    static_assert(count_v<LIST> > 0U && COUNTERS > 0U && SHARDS > 0U);
+    static_assert(SHARDS <= internal::max_thread_slots, "there are no more thread slots than max_thread_slots");
+
+public:
+    using types = LIST;
+    using counters_type = std::array<std::uint64_t, COUNTERS>;
+    using snapshot_type = type_indexed_array<LIST, counters_type>;
+
+    // The counter must be less than COUNTERS
+    template<typename T>
+    void add(std::size_t counter = 0U, std::uint64_t amount = 1U) noexcept
+    {
+        const std::size_t slot = internal::thread_slot();
+        std::atomic<std::uint64_t>& value = counter_of<T>(slot < SHARDS ? slot : SHARDS, counter);
+        if (slot < SHARDS) {
+            value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        } else {
+            value.fetch_add(amount, std::memory_order_relaxed);
+        }
+    }
+
+    // The sum of all shards. Each counter is read atomically, but counters may be added while the snapshot is taken.
+    snapshot_type snapshot() const noexcept
+    {
+        snapshot_type result;
+        for (const shard& current : shards_) {
+            for (std::size_t index = 0U; index < count_v<LIST>; ++index) {
+                for (std::size_t counter = 0U; counter < COUNTERS; ++counter) {
+                    result[index][counter] += current.counters[index * COUNTERS + counter].load(std::memory_order_relaxed);
+                }
+            }
+        }
+        return result;
+    }
+
+    // The names of the types, in the same order as the snapshot
+    static constexpr const std::array<std::string_view, count_v<LIST>>& names() noexcept
+    {
+        return type_names_v<LIST>;
+    }
+
+private:
+    struct alignas(cache_line_size) shard
+    {
+        std::array<std::atomic<std::uint64_t>, count_v<LIST> * COUNTERS> counters{};
+    };
+
+    template<typename T>
+    std::atomic<std::uint64_t>& counter_of(std::size_t shard_index, std::size_t counter) noexcept
+    {
+        return shards_[shard_index].counters[index_of_v<T, LIST> * COUNTERS + counter];
+    }
+
+    // the last shard is shared by all threads without an own shard
+    std::array<shard, SHARDS + 1U> shards_{};
+};
+
+} // namespace tmp
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "Typelist.hpp"
+#include "Algorithms.hpp"
+#include "Dispatch.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace tmp {
+
+enum class route_strategy
+{
+    // one table entry per tag in the range of the tags
+    direct,
+    // a table of pages over the range of the tags, pages without tags share one empty page
+    two_level,
+    // a search in the sorted tags, with a fixed number of steps and without branches on the tag
+    sorted_search,
+};
+
+namespace internal {
+
+// distance of the tag to the smallest tag, tags below the smallest wrap around to large distances
+template<typename TAG>
+constexpr std::uint64_t tag_offset(TAG tag, TAG min) noexcept
+{
+    return static_cast<std::uint64_t>(tag) - static_cast<std::uint64_t>(min);
+}
+
+template<typename TAG, std::size_t N>
+constexpr bool strictly_increasing(const std::array<TAG, N>& tags) noexcept
+{
+    for (std::size_t i = 1U; i < N; ++i) {
+        if (!(tags[i - 1U] < tags[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// number of distinct pages of 2^page_bits tags that contain a tag
+template<typename TAG, std::size_t N>
+constexpr std::size_t used_pages(const std::array<TAG, N>& tags, unsigned page_bits) noexcept
+{
+    std::size_t pages = 0U;
+    for (std::size_t i = 0U; i < N; ++i) {
+        if (i == 0U || (tag_offset(tags[i], tags[0]) >> page_bits) != (tag_offset(tags[i - 1U], tags[0]) >> page_bits)) {
+            ++pages;
+        }
+    }
+    return pages;
+}
+
+// entries of the top table and the pages, including the empty page.
+// The offset is shifted before adding 1, so it cannot overflow for tags that span all 64 bit values.
+template<typename TAG, std::size_t N>
+constexpr std::uint64_t two_level_entries(const std::array<TAG, N>& tags, unsigned page_bits) noexcept
+{
+    const std::uint64_t top_entries = (tag_offset(tags[N - 1U], tags[0]) >> page_bits) + 1U;
+    return top_entries + ((used_pages(tags, page_bits) + 1U) << page_bits);
+}
+
+template<typename TAG, std::size_t N>
+constexpr unsigned best_page_bits(const std::array<TAG, N>& tags) noexcept
+{
+    unsigned best = 2U;
+    for (unsigned page_bits = 3U; page_bits <= 16U; ++page_bits) {
+        if (two_level_entries(tags, page_bits) < two_level_entries(tags, best)) {
+            best = page_bits;
+        }
+    }
+    return best;
+}
+
+} // namespace internal
+
+// Routes a runtime tag to the type of the list with that tag as ::value, i.e. a wire id of a message type.
+// The types are sorted by their tags at compile time, duplicate tags are an error.
+// The lookup strategy depends on how dense the tags are:
+// dense tags (at most 4 table entries per type) use a direct table,
+// clustered tags (at most 32 table entries per type) use a two level table, all other tags use a sorted search.
+template<concepts::typelist LIST>
+class tag_router
+{
+    static_assert(count_v<LIST> > 0U, "a router needs at least one type");
+
+public:
+    using types = sort_t<LIST, internal::lt_value>;
+    using tag_type = common_value_type_t<LIST>;
+
+    static_assert(std::is_integral_v<tag_type>, "the tags must be integral values");
+
+private:
+    using index_type = smallest_unsigned_t<count_v<LIST>>;
+
+    static constexpr std::size_t size = count_v<LIST>;
+
+    static constexpr std::array<tag_type, size> tags = []<typename... ELEMENTs>(typelist<ELEMENTs...>) {
+        return std::array<tag_type, size>{static_cast<tag_type>(ELEMENTs::value)...};
+    }(types{});
+
+    static_assert(internal::strictly_increasing(tags), "the tags must be unique");
+
+    // the range of the tags is last_offset + 1, which does not fit into 64 bits if the tags span all values
+    static constexpr std::uint64_t last_offset = internal::tag_offset(tags[size - 1U], tags[0]);
+    static constexpr unsigned page_bits = internal::best_page_bits(tags);
+
+public:
+    static constexpr route_strategy strategy = last_offset < 4U * size
+                                               ? route_strategy::direct
+                                               : internal::two_level_entries(tags, page_bits) <= 32U * size
+                                                     ? route_strategy::two_level
+                                                     : route_strategy::sorted_search;
+
+private:
+    // entry is the index of the type with the tag, or size if there is none
+    static constexpr std::size_t direct_entries = strategy == route_strategy::direct ? last_offset + 1U : 0U;
+
+    static constexpr std::array<index_type, direct_entries> direct_table = [] {
+        std::array<index_type, direct_entries> table{};
+        table.fill(static_cast<index_type>(size));
+        for (std::size_t index = 0U; index < direct_entries && index < size; ++index) {
+            table[internal::tag_offset(tags[index], tags[0])] = static_cast<index_type>(index);
+        }
+        return table;
+    }();
+
+    static constexpr bool is_two_level = strategy == route_strategy::two_level;
+    static constexpr std::size_t pages = is_two_level ? internal::used_pages(tags, page_bits) : 0U;
+    static constexpr std::size_t top_entries = is_two_level ? (last_offset >> page_bits) + 1U : 0U;
+    static constexpr std::size_t page_entries = is_two_level ? (pages + 1U) << page_bits : 0U;
+
+    using page_type = smallest_unsigned_t<pages>;
+
+    // page 0 is the empty page
+    static constexpr std::array<page_type, top_entries> top_table = [] {
+        std::array<page_type, top_entries> table{};
+        page_type page = 0U;
+        for (std::size_t index = 0U; index < size && is_two_level; ++index) {
+            const std::uint64_t top = internal::tag_offset(tags[index], tags[0]) >> page_bits;
+            if (table[top] == 0U) {
+                table[top] = ++page;
+            }
+        }
+        return table;
+    }();
+
+    static constexpr std::array<index_type, page_entries> page_table = [] {
+        std::array<index_type, page_entries> table{};
+        table.fill(static_cast<index_type>(size));
+        for (std::size_t index = 0U; index < size && is_two_level; ++index) {
+            const std::uint64_t offset = internal::tag_offset(tags[index], tags[0]);
+            table[(std::size_t{top_table[offset >> page_bits]} << page_bits) | (offset & ((std::uint64_t{1U} << page_bits) - 1U))] = static_cast<index_type>(index);
+        }
+        return table;
+    }();
+
+public:
+    // index of the type with the tag in types, or count_v<LIST> if no type has the tag
+    static constexpr std::size_t find(tag_type tag) noexcept
+    {
+        const std::uint64_t offset = internal::tag_offset(tag, tags[0]);
+        if constexpr (strategy == route_strategy::direct) {
+            return offset <= last_offset ? direct_table[offset] : size;
+        } else if constexpr (strategy == route_strategy::two_level) {
+            if (offset > last_offset) {
+                return size;
+            }
+            return page_table[(std::size_t{top_table[offset >> page_bits]} << page_bits) | (offset & ((std::uint64_t{1U} << page_bits) - 1U))];
+        } else {
+            // the number of steps only depends on size, the conditional is a select and not a branch
+            std::size_t low = 0U;
+            for (std::size_t length = size; length > 1U; length -= length / 2U) {
+                const std::size_t middle = low + length / 2U;
+                low = tags[middle] <= tag ? middle : low;
+            }
+            return tags[low] == tag ? low : size;
+        }
+    }
+
+    // Calls the function with std::type_identity of the type with the tag.
+    // Returns false without calling the function if no type has the tag.
+    template<typename FUNCTION>
+    static constexpr bool route(tag_type tag, FUNCTION&& function)
+    {
+        const std::size_t index = find(tag);
+        if (index == size) {
+            return false;
+        }
+        dispatch<types>(index, std::forward<FUNCTION>(function));
+        return true;
+    }
+};
+
+} // namespace tmp
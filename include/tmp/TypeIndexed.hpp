@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "Typelist.hpp"
+#include "Algorithms.hpp"
+#include <array>
+#include <cstddef>
+#include <tuple>
+
+namespace tmp {
+
+// An array with one value per element of the list, a replacement for a map from type to value if all types are known.
+// get<T>() is a fixed offset into the array, operator[] takes the index of the type in the list.
+template<concepts::typelist LIST, typename VALUE>
+class type_indexed_array
+{
+    static_assert(count_v<unique_t<LIST>> == count_v<LIST>, "the types must be unique");
+
+public:
+    using types = LIST;
+    using value_type = VALUE;
+    using iterator = typename std::array<VALUE, count_v<LIST>>::iterator;
+    using const_iterator = typename std::array<VALUE, count_v<LIST>>::const_iterator;
+
+    static constexpr std::size_t size() noexcept
+    {
+        return count_v<LIST>;
+    }
+
+    template<typename T>
+    constexpr VALUE& get() noexcept
+    {
+        return values_[index_of_v<T, LIST>];
+    }
+
+    template<typename T>
+    constexpr const VALUE& get() const noexcept
+    {
+        return values_[index_of_v<T, LIST>];
+    }
+
+    // The index must be less than size()
+    constexpr VALUE& operator[](std::size_t index) noexcept
+    {
+        return values_[index];
+    }
+
+    constexpr const VALUE& operator[](std::size_t index) const noexcept
+    {
+        return values_[index];
+    }
+
+    constexpr iterator begin() noexcept
+    {
+        return values_.begin();
+    }
+
+    constexpr const_iterator begin() const noexcept
+    {
+        return values_.begin();
+    }
+
+    constexpr iterator end() noexcept
+    {
+        return values_.end();
+    }
+
+    constexpr const_iterator end() const noexcept
+    {
+        return values_.end();
+    }
+
+private:
+    std::array<VALUE, count_v<LIST>> values_{};
+};
+
+// Stores a FIELD<T> inline for every T of the list, get<T>() is a fixed offset.
+template<concepts::typelist LIST, template<typename> typename FIELD>
+class type_indexed_tuple;
+
+template<template<typename> typename FIELD, typename... ELEMENTs>
+class type_indexed_tuple<typelist<ELEMENTs...>, FIELD>
+{
+    static_assert(count_v<unique_t<typelist<ELEMENTs...>>> == sizeof...(ELEMENTs), "the types must be unique");
+
+public:
+    using types = typelist<ELEMENTs...>;
+
+    static constexpr std::size_t size() noexcept
+    {
+        return sizeof...(ELEMENTs);
+    }
+
+    template<typename T>
+    constexpr FIELD<T>& get() noexcept
+    {
+        return std::get<index_of_v<T, types>>(fields_);
+    }
+
+    template<typename T>
+    constexpr const FIELD<T>& get() const noexcept
+    {
+        return std::get<index_of_v<T, types>>(fields_);
+    }
+
+private:
+    std::tuple<FIELD<ELEMENTs>...> fields_{};
+};
+
+} // namespace tmp
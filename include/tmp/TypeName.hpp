@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "Typelist.hpp"
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace tmp {
+
+namespace internal {
+
+template<typename T>
+constexpr std::string_view function_signature()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+// the signature for a known type tells where the type name starts and how much follows it
+inline constexpr std::string_view probe_signature = function_signature<double>();
+inline constexpr std::size_t type_name_prefix = probe_signature.find("double");
+inline constexpr std::size_t type_name_suffix = probe_signature.size() - type_name_prefix - std::string_view{"double"}.size();
+
+constexpr std::string_view remove_keyword(std::string_view name, std::string_view keyword)
+{
+    return name.starts_with(keyword) ? name.substr(keyword.size()) : name;
+}
+
+template<typename T>
+constexpr std::string_view type_name()
+{
+    constexpr std::string_view signature = function_signature<T>();
+    constexpr std::string_view name = signature.substr(type_name_prefix, signature.size() - type_name_prefix - type_name_suffix);
+    return remove_keyword(remove_keyword(remove_keyword(name, "struct "), "class "), "enum ");
+}
+
+} // namespace internal
+
+// The name of the type as the compiler spells it, i.e. "int" or "ns::message"
+template<typename T>
+inline constexpr std::string_view type_name_v = internal::type_name<T>();
+
+// value is an array with the names of the elements of the list
+template<concepts::typelist LIST>
+struct type_names;
+
+template<concepts::typelist LIST>
+inline constexpr const auto& type_names_v = type_names<LIST>::value;
+
+template<typename... ELEMENTs>
+struct type_names<typelist<ELEMENTs...>>
+{
+    static constexpr std::array<std::string_view, sizeof...(ELEMENTs)> value = {type_name_v<ELEMENTs>...};
+};
+
+} // namespace tmp
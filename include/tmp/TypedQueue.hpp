@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "Typelist.hpp"
+#include "Algorithms.hpp"
+#include "Dispatch.hpp"
+#include "Hardware.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace tmp {
+
+namespace internal {
+
+// alignment must be a power of two
+constexpr std::size_t align_up(std::size_t value, std::size_t alignment)
+{
+    return (value + alignment - 1U) & ~(alignment - 1U);
+}
+
+} // namespace internal
+
+enum class queue_producers
+{
+    single,
+    multiple,
+};
+
+// A bounded lock-free ring buffer for messages of the types in the list, with one consumer and one or multiple producers.
+// A message is stored inline as a record: a header with the record size and the index of the type, followed by the object.
+// A record is only as large as its type needs, rounded up to record_alignment, the size of the header. The object is aligned
+// from its actual position behind the header, so a type with a large alignment does not make the records of the other types larger.
+// A record that does not fit before the end of the buffer is placed at the beginning, the rest of the buffer is skipped with a padding record.
+//
+// Single producer: producer and consumer publish their positions, the consumer sees all records up to the tail.
+// Multiple producers: the producers reserve space by advancing the tail and commit each record by writing its size.
+// The consumer stops at the first record that is not committed yet and clears consumed records,
+// so free space never contains a size that looks committed.
+template<concepts::typelist LIST, queue_producers PRODUCERS = queue_producers::single>
+class typed_queue
+{
+    static_assert(count_v<LIST> > 0U, "a queue needs at least one message type");
+    static_assert(count_v<unique_t<LIST>> == count_v<LIST>, "the message types must be unique");
+    static_assert(all_of_v<LIST, std::is_object>, "the message types must be object types");
+    static_assert(all_of_v<LIST, std::is_nothrow_destructible>, "the message types must be nothrow destructible");
+
+    using tag_type = smallest_unsigned_t<count_v<LIST>>;
+
+    // the tag after the last type marks a padding record
+    static constexpr tag_type padding_tag = static_cast<tag_type>(count_v<LIST>);
+
+    struct record_header
+    {
+        std::uint32_t size;
+        tag_type tag;
+    };
+
+public:
+    using types = LIST;
+
+    // every record starts at a multiple of the record alignment, so there is always room for a padding header
+    static constexpr std::size_t record_alignment = std::max(alignof(record_header), sizeof(record_header));
+
+    // offset of the T in a record at position: the header, then the padding to the alignment of T
+    template<typename T>
+    static constexpr std::size_t payload_offset_at(std::uint64_t position) noexcept
+    {
+        const std::size_t payload = static_cast<std::size_t>(position) + sizeof(record_header);
+        return internal::align_up(payload, alignof(T)) - static_cast<std::size_t>(position);
+    }
+
+    template<typename T>
+    static constexpr std::size_t record_size_at(std::uint64_t position) noexcept
+    {
+        return internal::align_up(payload_offset_at<T>(position) + sizeof(T), record_alignment);
+    }
+
+    // the largest record of a T, at a position that is aligned to alignof(T)
+    template<typename T>
+    static constexpr std::size_t record_size = record_size_at<T>(0U);
+
+    static constexpr std::size_t max_record_size = []<typename... ELEMENTs>(typelist<ELEMENTs...>) {
+        return std::max({record_size<ELEMENTs>...});
+    }(LIST{});
+
+    // The capacity in bytes is rounded up to a power of two that can hold at least two of the largest records
+    explicit typed_queue(std::size_t capacity)
+        : capacity_{std::bit_ceil(std::max(capacity, 2U * max_record_size))}
+        , buffer_{static_cast<std::byte*>(::operator new(capacity_, std::align_val_t{buffer_alignment}))}
+    {
+        assert(capacity_ <= std::size_t{1U} << 31U);
+        std::memset(buffer_, 0, capacity_);
+    }
+
+    typed_queue(const typed_queue&) = delete;
+    typed_queue& operator=(const typed_queue&) = delete;
+
+    ~typed_queue()
+    {
+        consume([](auto&) {});
+        ::operator delete(buffer_, std::align_val_t{buffer_alignment});
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    // Constructs a T from args in the queue. Returns false without constructing if the queue is full.
+    template<typename T, typename... ARGs>
+        requires has_a_v<LIST, T>
+    bool emplace(ARGs&&... args)
+    {
+        std::uint64_t position;
+        std::size_t skipped;
+        std::size_t size;
+        if (!reserve<T>(position, skipped, size)) {
+            return false;
+        }
+        if (skipped > 0U) {
+            commit(position, skipped, padding_tag);
+            position += skipped;
+        }
+        std::byte* record = buffer_ + (position & (capacity_ - 1U));
+        std::byte* payload = record + payload_offset_at<T>(position);
+        if constexpr (!std::is_nothrow_constructible_v<T, ARGs&&...>) {
+            // the space is reserved, a failed construction has to be committed as padding,
+            // or the consumer reads a stale record (single producer) or waits for it forever (multiple producers)
+            try {
+                ::new (static_cast<void*>(payload)) T(std::forward<ARGs>(args)...);
+            } catch (...) {
+                commit(position, size, padding_tag);
+                throw;
+            }
+        } else {
+            ::new (static_cast<void*>(payload)) T(std::forward<ARGs>(args)...);
+        }
+        commit(position, size, static_cast<tag_type>(index_of_v<T, LIST>));
+        return true;
+    }
+
+    // Calls the visitor with a reference to the oldest message and removes it.
+    // Returns false if there is no message. If the visitor throws, the message stays in the queue.
+    // Only one thread may consume.
+    template<typename VISITOR>
+    bool consume_one(VISITOR&& visitor)
+    {
+        while (true) {
+            record_header* header = header_at(head_position_);
+            std::uint32_t size;
+            if constexpr (PRODUCERS == queue_producers::single) {
+                if (head_position_ == cached_tail_) {
+                    cached_tail_ = tail_.load(std::memory_order_acquire);
+                    if (head_position_ == cached_tail_) {
+                        return false;
+                    }
+                }
+                size = header->size;
+            } else {
+                size = std::atomic_ref<std::uint32_t>{header->size}.load(std::memory_order_acquire);
+                if (size == 0U) {
+                    return false;
+                }
+            }
+
+            const bool is_message = header->tag != padding_tag;
+            if (is_message) {
+                std::byte* record = reinterpret_cast<std::byte*>(header);
+                dispatch<LIST>(header->tag, [this, record, &visitor]<typename T>(std::type_identity<T>) {
+                    T* message = std::launder(reinterpret_cast<T*>(record + payload_offset_at<T>(head_position_)));
+                    std::forward<VISITOR>(visitor)(*message);
+                    std::destroy_at(message);
+                });
+            }
+            if constexpr (PRODUCERS == queue_producers::multiple) {
+                std::memset(static_cast<void*>(header), 0, size);
+            }
+            head_position_ += size;
+            head_.store(head_position_, std::memory_order_release);
+            if (is_message) {
+                return true;
+            }
+        }
+    }
+
+    // Consumes all messages that are in the queue and returns the number of consumed messages
+    template<typename VISITOR>
+    std::size_t consume(VISITOR&& visitor)
+    {
+        std::size_t consumed = 0U;
+        while (consume_one(visitor)) {
+            ++consumed;
+        }
+        return consumed;
+    }
+
+private:
+    record_header* header_at(std::uint64_t position) noexcept
+    {
+        return reinterpret_cast<record_header*>(buffer_ + (position & (capacity_ - 1U)));
+    }
+
+    // space needed for a T record at position: the padding to the end of the buffer if the record does not fit, and the record.
+    // The size of the record depends on where it is placed.
+    template<typename T>
+    void place(std::uint64_t position, std::size_t& skipped, std::size_t& size) const noexcept
+    {
+        const std::size_t contiguous = capacity_ - (position & (capacity_ - 1U));
+        size = record_size_at<T>(position);
+        skipped = size > contiguous ? contiguous : 0U;
+        if (skipped > 0U) {
+            size = record_size_at<T>(position + skipped);
+        }
+    }
+
+    template<typename T>
+    bool reserve(std::uint64_t& position, std::size_t& skipped, std::size_t& size) noexcept
+    {
+        if constexpr (PRODUCERS == queue_producers::single) {
+            position = tail_position_;
+            place<T>(position, skipped, size);
+            if (position + skipped + size - cached_head_ > capacity_) {
+                cached_head_ = head_.load(std::memory_order_acquire);
+                if (position + skipped + size - cached_head_ > capacity_) {
+                    return false;
+                }
+            }
+            tail_position_ = position + skipped + size;
+            return true;
+        } else {
+            position = tail_.load(std::memory_order_relaxed);
+            while (true) {
+                place<T>(position, skipped, size);
+                const std::uint64_t head = head_.load(std::memory_order_acquire);
+                // the position is stale if the consumer moved past it, then the difference wraps around.
+                // The queue is only full if the check also fails with a fresh tail
+                if (head > position || position + skipped + size - head > capacity_) {
+                    const std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+                    if (tail == position) {
+                        return false;
+                    }
+                    position = tail;
+                    continue;
+                }
+                if (tail_.compare_exchange_weak(position, position + skipped + size, std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+        }
+    }
+
+    void commit(std::uint64_t position, std::size_t size, tag_type tag) noexcept
+    {
+        record_header* header = header_at(position);
+        header->tag = tag;
+        if constexpr (PRODUCERS == queue_producers::single) {
+            header->size = static_cast<std::uint32_t>(size);
+            tail_.store(position + size, std::memory_order_release);
+        } else {
+            std::atomic_ref<std::uint32_t>{header->size}.store(static_cast<std::uint32_t>(size), std::memory_order_release);
+        }
+    }
+
+    // written by the consumer
+    alignas(cache_line_size) std::atomic<std::uint64_t> head_{0U};
+    std::uint64_t head_position_{0U};
+    std::uint64_t cached_tail_{0U};
+
+    // written by the producers
+    alignas(cache_line_size) std::atomic<std::uint64_t> tail_{0U};
+    std::uint64_t tail_position_{0U};
+    std::uint64_t cached_head_{0U};
+
+    // the buffer is aligned for every type, so aligning a position aligns the address
+    static constexpr std::size_t buffer_alignment = std::max(record_alignment, alignof(max_t<LIST, gt_align>));
+
+    alignas(cache_line_size) const std::size_t capacity_;
+    std::byte* const buffer_;
+};
+
+} // namespace tmp
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Named module exporting the library: import tmp;
+// The headers are parsed once when the module is built, importers only load the compiled interface.
+
+module;
+
+#include <tmp/Typelist.hpp>
+#include <tmp/Algorithms.hpp>
+#include <tmp/Dispatch.hpp>
+#include <tmp/CompactVariant.hpp>
+#include <tmp/TypeIndexed.hpp>
+#include <tmp/Hardware.hpp>
+#include <tmp/TypeName.hpp>
+#include <tmp/PerTypeStats.hpp>
+#include <tmp/TypedQueue.hpp>
+#include <tmp/IsaDispatch.hpp>
+#include <tmp/TagRouter.hpp>
+
+export module tmp;
+
+export namespace tmp::concepts {
+using tmp::concepts::typelist;
+} // namespace tmp::concepts
+
+// Typelist.hpp
+export namespace tmp {
+using tmp::append;
+using tmp::append_t;
+using tmp::at;
+using tmp::at_t;
+using tmp::back;
+using tmp::back_t;
+using tmp::common_type;
+using tmp::common_type_t;
+using tmp::common_value_type;
+using tmp::common_value_type_t;
+using tmp::concat;
+using tmp::concat_t;
+using tmp::count;
+using tmp::count_v;
+using tmp::front;
+using tmp::front_t;
+using tmp::index_of;
+using tmp::index_of_v;
+using tmp::is_typelist;
+using tmp::is_typelist_v;
+using tmp::linearize;
+using tmp::linearize_t;
+using tmp::nil_type;
+using tmp::prepend;
+using tmp::prepend_t;
+using tmp::remove_at;
+using tmp::remove_at_t;
+using tmp::remove_back;
+using tmp::remove_back_t;
+using tmp::remove_front;
+using tmp::remove_front_t;
+using tmp::reverse;
+using tmp::reverse_t;
+using tmp::typelist;
+} // namespace tmp
+
+// Algorithms.hpp
+export namespace tmp {
+using tmp::all_of;
+using tmp::all_of_v;
+using tmp::any_of;
+using tmp::any_of_v;
+using tmp::combinations;
+using tmp::combinations_t;
+using tmp::count_if;
+using tmp::count_if_v;
+using tmp::filter;
+using tmp::filter_t;
+using tmp::find_if;
+using tmp::find_if_t;
+using tmp::group_by;
+using tmp::group_by_t;
+using tmp::gt_align;
+using tmp::gt_align_v;
+using tmp::gt_size;
+using tmp::gt_size_v;
+using tmp::has_a;
+using tmp::has_a_v;
+using tmp::lt_align;
+using tmp::lt_align_v;
+using tmp::lt_size;
+using tmp::lt_size_v;
+using tmp::max;
+using tmp::max_t;
+using tmp::memoize;
+using tmp::min;
+using tmp::min_t;
+using tmp::none_of;
+using tmp::none_of_v;
+using tmp::partition;
+using tmp::partition_t;
+using tmp::product;
+using tmp::product_t;
+using tmp::remove_if;
+using tmp::remove_if_t;
+using tmp::smallest_unsigned;
+using tmp::smallest_unsigned_t;
+using tmp::sort;
+using tmp::sort_t;
+using tmp::stable_partition;
+using tmp::stable_partition_t;
+using tmp::sum;
+using tmp::sum_v;
+using tmp::transform;
+using tmp::transform_t;
+using tmp::unique;
+using tmp::unique_keep_last;
+using tmp::unique_keep_last_t;
+using tmp::unique_t;
+} // namespace tmp
+
+// Dispatch.hpp
+export namespace tmp {
+using tmp::dispatch;
+using tmp::dispatch2;
+} // namespace tmp
+
+// CompactVariant.hpp
+export namespace tmp {
+using tmp::compact_variant;
+} // namespace tmp
+
+// TypeIndexed.hpp
+export namespace tmp {
+using tmp::type_indexed_array;
+using tmp::type_indexed_tuple;
+} // namespace tmp
+
+// Hardware.hpp
+export namespace tmp {
+using tmp::available_cpu_features;
+using tmp::cache_line_size;
+using tmp::cpu_feature;
+using tmp::cpu_feature_level;
+using tmp::detect_cpu_features;
+using tmp::has_cpu_features;
+using tmp::x86_64_v2;
+using tmp::x86_64_v3;
+using tmp::x86_64_v4;
+using tmp::operator|;
+using tmp::operator&;
+} // namespace tmp
+
+// TypeName.hpp
+export namespace tmp {
+using tmp::type_name_v;
+using tmp::type_names;
+using tmp::type_names_v;
+} // namespace tmp
+
+// PerTypeStats.hpp
+export namespace tmp {
+using tmp::per_type_stats;
+} // namespace tmp
+
+// TypedQueue.hpp
+export namespace tmp {
+using tmp::queue_producers;
+using tmp::typed_queue;
+} // namespace tmp
+
+// IsaDispatch.hpp
+export namespace tmp {
+using tmp::isa_dispatch;
+} // namespace tmp
+
+// TagRouter.hpp
+export namespace tmp {
+using tmp::route_strategy;
+using tmp::tag_router;
+} // namespace tmp
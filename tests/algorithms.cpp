@@ -150,3 +150,77 @@ namespace Sort {
     static_assert(std::is_same_v<sort_t<list_desc, gt_size>, list_desc>);
     static_assert(std::is_same_v<sort_t<list_unsorted, lt_size>, list_asc>);
 } // namespace Sort
+
+namespace Align {
+    static_assert(gt_align_v<std::uint32_t, std::uint8_t> == true);
+    static_assert(gt_align_v<std::uint8_t, std::uint32_t> == false);
+    static_assert(lt_align_v<std::uint32_t, std::uint8_t> == false);
+    static_assert(lt_align_v<std::uint8_t, std::uint32_t> == true);
+    static_assert(std::is_same_v<max_t<typelist<char, std::uint64_t, short>, gt_align>, std::uint64_t>);
+} // namespace Align
+
+namespace SmallestUnsigned {
+    static_assert(std::is_same_v<smallest_unsigned_t<0>, std::uint8_t>);
+    static_assert(std::is_same_v<smallest_unsigned_t<255>, std::uint8_t>);
+    static_assert(std::is_same_v<smallest_unsigned_t<256>, std::uint16_t>);
+    static_assert(std::is_same_v<smallest_unsigned_t<65536>, std::uint32_t>);
+    static_assert(std::is_same_v<smallest_unsigned_t<4294967296>, std::uint64_t>);
+} // namespace SmallestUnsigned
+
+namespace Partition {
+    static_assert(std::is_same_v<partition_t<empty, std::is_integral>, typelist<empty, empty>>);
+    static_assert(std::is_same_v<partition_t<typelist<float, void, double>, std::is_integral>, typelist<empty, typelist<float, void, double>>>);
+    static_assert(std::is_same_v<partition_t<typelist<bool, void, char, float>, std::is_integral>, typelist<typelist<bool, char>, typelist<void, float>>>);
+    static_assert(std::is_same_v<front_t<partition_t<typelist<bool, void, char, void>, std::is_integral>>, filter_t<typelist<bool, void, char, void>, std::is_integral>>);
+    static_assert(std::is_same_v<back_t<partition_t<typelist<bool, void, char, void>, std::is_integral>>, remove_if_t<typelist<bool, void, char, void>, std::is_integral>>);
+
+    static_assert(std::is_same_v<stable_partition_t<empty, std::is_integral>, empty>);
+    static_assert(std::is_same_v<stable_partition_t<typelist<void, bool, float, char>, std::is_integral>, typelist<bool, char, void, float>>);
+} // namespace Partition
+
+namespace GroupBy {
+    template<typename T>
+    struct size_key : std::integral_constant<std::size_t, sizeof(T)> {};
+
+    static_assert(std::is_same_v<group_by_t<empty, size_key>, empty>);
+    static_assert(std::is_same_v<group_by_t<typelist<std::uint8_t>, size_key>, typelist<typelist<std::uint8_t>>>);
+    static_assert(std::is_same_v<group_by_t<typelist<std::uint32_t, std::uint8_t, std::int32_t, std::int8_t, std::uint64_t>, size_key>,
+                                 typelist<typelist<std::uint32_t, std::int32_t>, typelist<std::uint8_t, std::int8_t>, typelist<std::uint64_t>>>);
+    static_assert(std::is_same_v<group_by_t<typelist<test1, int, test2>, std::is_class>, typelist<typelist<test1, test2>, typelist<int>>>);
+} // namespace GroupBy
+
+namespace Product {
+    static_assert(std::is_same_v<product_t<>, typelist<empty>>);
+    static_assert(std::is_same_v<product_t<empty>, empty>);
+    static_assert(std::is_same_v<product_t<firstTwo, empty>, empty>);
+    static_assert(std::is_same_v<product_t<firstTwo>, typelist<first, second>>);
+    static_assert(std::is_same_v<product_t<firstTwo, secondTwo>,
+                                 typelist<typelist<test1, test3>, typelist<test1, test4>, typelist<test2, test3>, typelist<test2, test4>>>);
+    static_assert(std::is_same_v<product_t<firstTwo, typelist<int>, secondTwo>,
+                                 typelist<typelist<test1, int, test3>, typelist<test1, int, test4>, typelist<test2, int, test3>, typelist<test2, int, test4>>>);
+    static_assert(count_v<product_t<all, all, all>> == 64U);
+    static_assert(std::is_same_v<at_t<27, product_t<all, all, all>>, typelist<test2, test3, test4>>);
+} // namespace Product
+
+namespace Combinations {
+    static_assert(std::is_same_v<combinations_t<all, 0>, typelist<empty>>);
+    static_assert(std::is_same_v<combinations_t<firstTwo, 3>, empty>);
+    static_assert(std::is_same_v<combinations_t<all, 1>, typelist<first, second, typelist<test3>, typelist<test4>>>);
+    static_assert(std::is_same_v<combinations_t<typelist<test1, test2, test3>, 2>,
+                                 typelist<firstTwo, typelist<test1, test3>, typelist<test2, test3>>>);
+    static_assert(std::is_same_v<combinations_t<all, 4>, typelist<all>>);
+    static_assert(count_v<combinations_t<all, 2>> == 6U);
+    static_assert(std::is_same_v<back_t<combinations_t<all, 3>>, typelist<test2, test3, test4>>);
+} // namespace Combinations
+
+namespace Memoize {
+    static_assert(std::is_same_v<memoize<std::is_integral>::fn<int>, std::true_type>);
+    static_assert(std::is_same_v<memoize<std::is_integral>::fn<float>, std::false_type>);
+    static_assert(std::is_same_v<memoize<gt_size>::fn<int, char>, std::true_type>);
+    static_assert(std::is_same_v<memoize<std::make_unsigned>::fn<int>, std::type_identity<unsigned int>>);
+
+    static_assert(std::is_same_v<filter_t<typelist<bool, void, char>, memoize<std::is_integral>::fn>, typelist<bool, char>>);
+    static_assert(count_if_v<typelist<bool, void, char>, memoize<std::is_integral>::fn> == 2U);
+    static_assert(std::is_same_v<transform_t<typelist<char, int>, memoize<std::make_unsigned>::fn>, typelist<unsigned char, unsigned int>>);
+    static_assert(std::is_same_v<sort_t<Sort::list_unsorted, memoize<lt_size>::fn>, Sort::list_asc>);
+} // namespace Memoize
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime.hpp"
+#include <tmp/CompactVariant.hpp>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using namespace tmp;
+
+namespace CompactVariant {
+    using small = compact_variant<typelist<std::uint8_t, std::uint16_t>>;
+    static_assert(std::is_same_v<small::index_type, std::uint8_t>);
+    static_assert(sizeof(small) == 4U);
+    static_assert(alignof(small) == alignof(std::uint16_t));
+    static_assert(std::is_trivially_copyable_v<small>);
+    static_assert(std::is_trivially_destructible_v<small>);
+
+    struct event1 { std::uint32_t id; };
+    struct event2 { std::uint64_t timestamp; std::uint8_t flags; };
+    struct event3 { char payload[13]; };
+    using events = compact_variant<typelist<event1, event2, event3>>;
+    static_assert(sizeof(events) == sizeof(event2) + alignof(event2));
+    static_assert(std::is_trivially_copyable_v<events>);
+
+    using strings = compact_variant<typelist<int, std::string>>;
+    static_assert(!std::is_trivially_copyable_v<strings>);
+    static_assert(std::is_copy_constructible_v<strings>);
+    static_assert(std::is_nothrow_move_constructible_v<strings>);
+    static_assert(std::is_constructible_v<strings, std::string>);
+    static_assert(std::is_constructible_v<strings, const int&>);
+    static_assert(!std::is_constructible_v<strings, float>);
+    static_assert(std::is_copy_assignable_v<strings>);
+    static_assert(std::is_nothrow_move_assignable_v<strings>);
+
+    // emplace cannot replace a value that copies and moves with exceptions, so there is no assignment
+    struct fragile
+    {
+        fragile() = default;
+        fragile(const fragile&) {}
+        fragile(fragile&&) {}
+        fragile& operator=(const fragile&) = default;
+    };
+    using fragiles = compact_variant<typelist<int, fragile>>;
+    static_assert(std::is_copy_constructible_v<fragiles>);
+    static_assert(std::is_move_constructible_v<fragiles>);
+    static_assert(!std::is_copy_assignable_v<fragiles>);
+    static_assert(!std::is_move_assignable_v<fragiles>);
+
+    // a copy that may throw is made before the old value is destroyed and then moved
+    struct copy_throws
+    {
+        copy_throws() = default;
+        copy_throws(const copy_throws&) {}
+        copy_throws(copy_throws&&) noexcept = default;
+    };
+    static_assert(std::is_copy_assignable_v<compact_variant<typelist<int, copy_throws>>>);
+} // namespace CompactVariant
+
+namespace CompactVariant {
+    // counts the living objects, to check that every constructed value is destroyed exactly once
+    struct tracked
+    {
+        static inline int living = 0;
+
+        explicit tracked(std::string value) : text{std::move(value)} { ++living; }
+        tracked(const tracked& other) : text{other.text} { ++living; }
+        tracked(tracked&& other) noexcept : text{std::move(other.text)} { ++living; }
+        tracked& operator=(const tracked&) = default;
+        ~tracked() { --living; }
+
+        std::string text;
+    };
+
+    struct thrower
+    {
+        explicit thrower(int number)
+        {
+            if (number < 0) {
+                throw number;
+            }
+        }
+    };
+
+    using values = compact_variant<typelist<int, std::string, tracked, thrower>>;
+
+    // longer than the small string buffer, so a copy allocates and a move takes the allocation
+    const std::string long_text(64U, 'x');
+
+    std::string text_of(const values& value)
+    {
+        return value.visit([]<typename T>(const T& alternative) -> std::string {
+            if constexpr (std::is_same_v<T, std::string>) {
+                return alternative;
+            } else if constexpr (std::is_same_v<T, tracked>) {
+                return alternative.text;
+            } else {
+                return {};
+            }
+        });
+    }
+
+    void copy_and_move()
+    {
+        values original{long_text};
+        values copy{original};
+        runtime::check(copy.holds_alternative<std::string>() && copy.get<std::string>() == long_text);
+        runtime::check(original.get<std::string>() == long_text);
+
+        const char* const data = copy.get<std::string>().data();
+        values moved{std::move(copy)};
+        runtime::check(moved.get<std::string>().data() == data);
+        runtime::check(text_of(moved) == long_text);
+
+        values tracked_value{std::in_place_type<tracked>, long_text};
+        values tracked_copy{tracked_value};
+        values tracked_moved{std::move(tracked_copy)};
+        runtime::check(tracked::living == 3);
+        runtime::check(text_of(tracked_moved) == long_text);
+    }
+
+    void cross_alternative_assignment()
+    {
+        values value{42};
+        const values text{long_text};
+        const values tracked_value{std::in_place_type<tracked>, std::string{"tracked"}};
+
+        value = text;
+        runtime::check(value.get<std::string>() == long_text);
+        value = tracked_value;
+        runtime::check(value.holds_alternative<tracked>() && text_of(value) == "tracked");
+        runtime::check(tracked::living == 2);
+        value = values{7};
+        runtime::check(value.get<int>() == 7);
+        runtime::check(tracked::living == 1);
+        value = values{long_text};
+        runtime::check(value.get<std::string>() == long_text);
+        value = values{std::in_place_type<tracked>, long_text};
+        runtime::check(text_of(value) == long_text);
+        runtime::check(tracked::living == 2);
+        // self assignment keeps the value
+        values& self = value;
+        value = self;
+        runtime::check(text_of(value) == long_text);
+    }
+
+    void emplace_throws()
+    {
+        values value{std::in_place_type<tracked>, long_text};
+        try {
+            value.emplace<thrower>(-1);
+            runtime::check(false);
+        } catch (int) {
+        }
+        // the old value is not destroyed
+        runtime::check(value.holds_alternative<tracked>() && text_of(value) == long_text);
+        runtime::check(tracked::living == 1);
+
+        value.emplace<thrower>(1);
+        runtime::check(value.holds_alternative<thrower>());
+        runtime::check(tracked::living == 0);
+    }
+} // namespace CompactVariant
+
+void runtime::compact_variant()
+{
+    CompactVariant::copy_and_move();
+    CompactVariant::cross_alternative_assignment();
+    CompactVariant::emplace_throws();
+    check(CompactVariant::tracked::living == 0);
+}
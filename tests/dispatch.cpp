@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <tmp/Dispatch.hpp>
+#include <cstdint>
+#include <type_traits>
+
+using namespace tmp;
+
+namespace Dispatch {
+    using list = typelist<std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t>;
+
+    constexpr std::size_t size_at(std::size_t index)
+    {
+        return dispatch<list>(index, []<typename T>(std::type_identity<T>) { return sizeof(T); });
+    }
+
+    static_assert(size_at(0) == 1U);
+    static_assert(size_at(1) == 2U);
+    static_assert(size_at(2) == 4U);
+    static_assert(size_at(3) == 8U);
+
+    constexpr std::size_t first_index_of_size(std::size_t size)
+    {
+        std::size_t found = count_v<list>;
+        for (std::size_t i = 0; i < count_v<list>; ++i) {
+            // the function is passed by reference and can keep state
+            auto matches = [size, &found, i]<typename T>(std::type_identity<T>) {
+                if (sizeof(T) == size && found == count_v<list>) {
+                    found = i;
+                }
+            };
+            dispatch<list>(i, matches);
+        }
+        return found;
+    }
+
+    static_assert(first_index_of_size(4) == 2U);
+    static_assert(first_index_of_size(3) == count_v<list>);
+} // namespace Dispatch
+
+namespace Dispatch2 {
+    using lhs = typelist<std::uint8_t, std::uint16_t, std::uint32_t>;
+    using rhs = typelist<std::uint8_t, std::uint64_t>;
+
+    constexpr std::size_t sizes(std::size_t index1, std::size_t index2)
+    {
+        return dispatch2<lhs, rhs>(index1, index2, []<typename T1, typename T2>(std::type_identity<T1>, std::type_identity<T2>) {
+            return sizeof(T1) * 10U + sizeof(T2);
+        });
+    }
+
+    static_assert(sizes(0, 0) == 11U);
+    static_assert(sizes(0, 1) == 18U);
+    static_assert(sizes(1, 0) == 21U);
+    static_assert(sizes(1, 1) == 28U);
+    static_assert(sizes(2, 0) == 41U);
+    static_assert(sizes(2, 1) == 48U);
+} // namespace Dispatch2
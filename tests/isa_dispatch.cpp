@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime.hpp"
+#include <tmp/IsaDispatch.hpp>
+#include <cstddef>
+#include <cstdlib>
+
+using namespace tmp;
+
+namespace IsaDispatch {
+    struct avx512_impl
+    {
+        static constexpr cpu_feature required_features = cpu_feature::avx512f | cpu_feature::avx512bw;
+        static int run(int value) { return value * 4; }
+    };
+
+    struct avx2_impl
+    {
+        static constexpr cpu_feature required_features = cpu_feature::avx2 | cpu_feature::fma;
+        static int run(int value) { return value * 3; }
+    };
+
+    struct sse42_impl
+    {
+        static constexpr cpu_feature required_features = cpu_feature::sse42;
+        static int run(int value) { return value * 2; }
+    };
+
+    struct scalar_impl
+    {
+        static constexpr cpu_feature required_features = cpu_feature::none;
+        static int run(int value) { return value; }
+    };
+
+    using kernel = isa_dispatch<typelist<avx512_impl, avx2_impl, sse42_impl, scalar_impl>>;
+
+    static_assert(kernel::index_for(cpu_feature::none) == 3U);
+    static_assert(kernel::index_for(cpu_feature::avx2) == 3U);
+    static_assert(kernel::index_for(cpu_feature::avx2 | cpu_feature::fma) == 1U);
+    static_assert(kernel::index_for(cpu_feature::all) == 0U);
+
+    // the levels of TMP_CPU_LEVEL select each implementation
+    static_assert(kernel::index_for(cpu_feature_level("avx512")) == 0U);
+    static_assert(kernel::index_for(cpu_feature_level("x86-64-v4")) == 0U);
+    static_assert(kernel::index_for(cpu_feature_level("avx2")) == 1U);
+    static_assert(kernel::index_for(cpu_feature_level("x86-64-v3")) == 1U);
+    static_assert(kernel::index_for(cpu_feature_level("sse4.2")) == 2U);
+    static_assert(kernel::index_for(cpu_feature_level("x86-64-v2")) == 2U);
+    static_assert(kernel::index_for(cpu_feature_level("scalar")) == 3U);
+    // a level only limits the detected features
+    static_assert(kernel::index_for(cpu_feature_level("avx512") & x86_64_v2) == 2U);
+    static_assert(cpu_feature_level("unknown") == cpu_feature::all);
+
+    static_assert(has_cpu_features(x86_64_v4, x86_64_v3));
+    static_assert(!has_cpu_features(x86_64_v2, x86_64_v3));
+} // namespace IsaDispatch
+
+// ctest runs this once per TMP_CPU_LEVEL, each run binds the implementation of its level
+void runtime::isa_dispatch()
+{
+    using IsaDispatch::kernel;
+    const char* level = std::getenv("TMP_CPU_LEVEL");
+    const cpu_feature expected_features = detect_cpu_features() & (level != nullptr ? cpu_feature_level(level) : cpu_feature::all);
+    check(available_cpu_features() == expected_features);
+
+    const std::size_t expected = kernel::index_for(expected_features);
+    constexpr int results[] = {4, 3, 2, 1};
+    constexpr decltype(kernel::target()) implementations[] = {
+        &IsaDispatch::avx512_impl::run, &IsaDispatch::avx2_impl::run, &IsaDispatch::sse42_impl::run, &IsaDispatch::scalar_impl::run};
+    // the first call binds through resolve, later calls use the bound function
+    check(kernel::call(1) == results[expected]);
+    check(kernel::call(1) == results[expected]);
+    check(kernel::target() == implementations[expected]);
+}
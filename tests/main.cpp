@@ -4,8 +4,39 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include "runtime.hpp"
 #include <print>
+#include <string_view>
+
+namespace {
+
+struct test
+{
+    std::string_view name;
+    void (*run)();
+};
+
+constexpr test tests[] = {
+    {"compact_variant", &runtime::compact_variant},
+    {"isa_dispatch", &runtime::isa_dispatch},
+    {"per_type_stats", &runtime::per_type_stats},
+    {"typed_queue", &runtime::typed_queue},
+};
+
+} // namespace
 
 int main(int argc, const char* argv[]) {
-    std::print("nothing to execute\n");
+    const std::string_view selected = argc > 1 ? argv[1] : "";
+    bool found = false;
+    for (const test& current : tests) {
+        if (selected.empty() || selected == current.name) {
+            found = true;
+            current.run();
+        }
+    }
+    if (!found) {
+        std::print(stderr, "unknown test {}\n", selected);
+        return 1;
+    }
+    return runtime::failures == 0 ? 0 : 1;
 }
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Built with TMP_BUILD_MODULE only. Uses the library through import tmp; without including any header,
+// so every name used here must be exported by modules/tmp.cppm.
+
+import tmp;
+
+namespace ModuleImport {
+    template<int ID>
+    struct message
+    {
+        static constexpr int value = ID;
+    };
+
+    template<typename T>
+    struct is_short
+    {
+        static constexpr bool value = sizeof(T) == sizeof(short);
+    };
+
+    // Typelist.hpp and Algorithms.hpp
+    using list = tmp::typelist<char, short, int, short>;
+    static_assert(tmp::concepts::typelist<list>);
+    static_assert(tmp::count_v<tmp::unique_t<list>> == 3U);
+    static_assert(tmp::index_of_v<int, list> == 2U);
+    static_assert(tmp::count_if_v<list, tmp::memoize<is_short>::fn> == 2U);
+    static_assert(tmp::count_v<tmp::sort_t<list, tmp::gt_size>> == 4U);
+    static_assert(sizeof(tmp::smallest_unsigned_t<200U>) == 1U);
+    using types = tmp::unique_t<list>;
+
+    // Dispatch.hpp, TypeName.hpp and Hardware.hpp
+    static_assert(tmp::dispatch<list>(2U, []<typename IDENTITY>(IDENTITY) { return sizeof(typename IDENTITY::type); }) == sizeof(int));
+    static_assert(tmp::type_name_v<int> == "int");
+    static_assert(tmp::has_cpu_features(tmp::x86_64_v3, tmp::cpu_feature::avx2 | tmp::cpu_feature::fma));
+
+    // TagRouter.hpp
+    using router = tmp::tag_router<tmp::typelist<message<7>, message<3>>>;
+    static_assert(router::find(7) == 1U);
+
+    struct scalar
+    {
+        static constexpr tmp::cpu_feature required_features = tmp::cpu_feature::none;
+        static int run(int value) { return value + 1; }
+    };
+} // namespace ModuleImport
+
+int main()
+{
+    using namespace ModuleImport;
+
+    // CompactVariant.hpp and TypeIndexed.hpp
+    tmp::compact_variant<types> variant{42};
+    variant.emplace<short>(short{7});
+    tmp::type_indexed_array<types, int> sizes{};
+    sizes.get<int>() = variant.visit([]<typename T>(T& value) { return static_cast<int>(value); });
+
+    // PerTypeStats.hpp, TypedQueue.hpp and IsaDispatch.hpp
+    tmp::per_type_stats<types> stats;
+    stats.add<int>();
+    tmp::typed_queue<types, tmp::queue_producers::multiple> queue{0U};
+    queue.emplace<int>(sizes.get<int>());
+    int received = 0;
+    queue.consume([&received]<typename T>(T& value) { received = static_cast<int>(value); });
+    const int result = tmp::isa_dispatch<tmp::typelist<scalar>>::call(received);
+
+    return result == 8 && stats.snapshot().get<int>()[0] == 1U ? 0 : 1;
+}
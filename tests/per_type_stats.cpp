@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime.hpp"
+#include <tmp/PerTypeStats.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <latch>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace tmp;
+
+namespace PerTypeStats {
+    struct test1 {};
+    struct test2 {};
+    struct test3 {};
+
+    using stats = per_type_stats<typelist<test1, test2, test3>, 2, 4>;
+
+    static_assert(alignof(stats) == cache_line_size);
+    // 3 types with 2 counters fit in one cache line per shard, 4 shards and the shared one
+    static_assert(sizeof(stats) == 5U * cache_line_size);
+    static_assert(sizeof(per_type_stats<typelist<test1, test2, test3>, 4, 1>) == 2U * 2U * cache_line_size);
+
+    static_assert(std::is_same_v<stats::snapshot_type, type_indexed_array<typelist<test1, test2, test3>, std::array<std::uint64_t, 2>>>);
+    static_assert(stats::names()[1] == "PerTypeStats::test2");
+} // namespace PerTypeStats
+
+namespace PerTypeStats {
+    // adds from its destructor, after the slot of the thread was returned if it was constructed before the slot owner
+    struct exit_flush
+    {
+        ~exit_flush()
+        {
+            counters->add<test2>();
+            slot = internal::thread_slot();
+        }
+
+        stats* counters;
+        std::size_t& slot;
+    };
+} // namespace PerTypeStats
+
+// More threads than shards run at the same time, so some of them add to the shared shard
+void runtime::per_type_stats()
+{
+    using namespace PerTypeStats;
+    constexpr std::size_t threads_count = 8U;
+    constexpr std::uint64_t adds = 100000U;
+
+    stats counters;
+    std::latch all_have_a_slot{threads_count};
+    std::vector<std::thread> threads;
+    for (std::size_t thread = 0U; thread < threads_count; ++thread) {
+        threads.emplace_back([&counters, &all_have_a_slot] {
+            counters.add<test1>();
+            // no thread exits and returns its slot before all threads have one
+            all_have_a_slot.arrive_and_wait();
+            for (std::uint64_t add = 1U; add < adds; ++add) {
+                counters.add<test1>();
+                counters.add<test3>(1U, 2U);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    const stats::snapshot_type totals = counters.snapshot();
+    check(totals.get<test1>()[0] == threads_count * adds);
+    check(totals.get<test1>()[1] == 0U);
+    check(totals.get<test2>()[0] == 0U && totals.get<test2>()[1] == 0U);
+    check(totals.get<test3>()[0] == 0U);
+    check(totals.get<test3>()[1] == threads_count * (adds - 1U) * 2U);
+
+    // an add after the slot was returned goes to the shared shard
+    std::size_t late_slot = 0U;
+    std::thread([&counters, &late_slot] {
+        thread_local exit_flush flush{&counters, late_slot};
+        counters.add<test2>();
+    }).join();
+    check(late_slot == internal::max_thread_slots);
+    check(counters.snapshot().get<test2>()[0] == 2U);
+
+    // the slots of the exited threads are reused
+    std::size_t slot = internal::max_thread_slots;
+    std::thread([&slot] { slot = internal::thread_slot(); }).join();
+    check(slot < 4U);
+}
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <print>
+#include <source_location>
+
+// Most tests are static_asserts. Behaviour that only exists at runtime is tested by these functions,
+// main runs the test given as argument, or all of them.
+namespace runtime {
+
+inline int failures = 0;
+
+inline void check(bool condition, std::source_location location = std::source_location::current())
+{
+    if (!condition) {
+        ++failures;
+        std::print(stderr, "{}:{}: check failed\n", location.file_name(), location.line());
+    }
+}
+
+void compact_variant();
+void isa_dispatch();
+void per_type_stats();
+void typed_queue();
+
+} // namespace runtime
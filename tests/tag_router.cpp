@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <tmp/TagRouter.hpp>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+using namespace tmp;
+
+namespace TagRouter {
+    template<auto ID>
+    struct message : std::integral_constant<decltype(ID), ID> {};
+
+    // the value of the tag of the routed type, or -1
+    template<typename ROUTER>
+    constexpr long routed(typename ROUTER::tag_type tag)
+    {
+        long result = -1;
+        ROUTER::route(tag, [&result]<typename T>(std::type_identity<T>) { result = T::value; });
+        return result;
+    }
+
+    using dense = tag_router<typelist<message<3>, message<1>, message<2>, message<5>>>;
+    static_assert(dense::strategy == route_strategy::direct);
+    static_assert(std::is_same_v<dense::types, typelist<message<1>, message<2>, message<3>, message<5>>>);
+    static_assert(dense::find(1) == 0U);
+    static_assert(dense::find(5) == 3U);
+    static_assert(dense::find(4) == 4U);
+    static_assert(dense::find(0) == 4U);
+    static_assert(dense::find(6) == 4U);
+    static_assert(routed<dense>(3) == 3);
+    static_assert(routed<dense>(4) == -1);
+
+    // 16 consecutive tags from FIRST
+    template<int FIRST>
+    using cluster = decltype([]<std::size_t... Is>(std::index_sequence<Is...>) {
+        return typelist<message<FIRST + static_cast<int>(Is)>...>{};
+    }(std::make_index_sequence<16>{}));
+
+    using clustered = tag_router<concat_t<concat_t<cluster<65000>, cluster<1>>, cluster<300>>>;
+    static_assert(clustered::strategy == route_strategy::two_level);
+    static_assert(routed<clustered>(1) == 1);
+    static_assert(routed<clustered>(315) == 315);
+    static_assert(routed<clustered>(65015) == 65015);
+    static_assert(routed<clustered>(0) == -1);
+    static_assert(routed<clustered>(17) == -1);
+    static_assert(routed<clustered>(299) == -1);
+    static_assert(routed<clustered>(1000) == -1);
+    static_assert(routed<clustered>(65016) == -1);
+
+    using sparse = tag_router<typelist<message<65000>, message<7>, message<300>, message<1>>>;
+    static_assert(sparse::strategy == route_strategy::sorted_search);
+    static_assert(sparse::find(1) == 0U);
+    static_assert(sparse::find(7) == 1U);
+    static_assert(sparse::find(300) == 2U);
+    static_assert(sparse::find(65000) == 3U);
+    static_assert(routed<sparse>(300) == 300);
+    static_assert(routed<sparse>(0) == -1);
+    static_assert(routed<sparse>(8) == -1);
+    static_assert(routed<sparse>(70000) == -1);
+
+    using negative = tag_router<typelist<message<-2>, message<0>, message<-1>>>;
+    static_assert(negative::strategy == route_strategy::direct);
+    static_assert(routed<negative>(-2) == -2);
+    static_assert(routed<negative>(-3) == -1);
+    static_assert(routed<negative>(1) == -1);
+
+    using single = tag_router<typelist<message<std::uint8_t{42}>>>;
+    static_assert(std::is_same_v<single::tag_type, std::uint8_t>);
+    static_assert(routed<single>(42) == 42);
+    static_assert(routed<single>(41) == -1);
+
+    // the tags span all values of the tag type, the range does not fit into the tag type or 64 bits
+    using unsigned_extremes = tag_router<typelist<message<std::numeric_limits<std::uint64_t>::max()>, message<std::uint64_t{0}>>>;
+    static_assert(unsigned_extremes::strategy == route_strategy::sorted_search);
+    static_assert(unsigned_extremes::find(0U) == 0U);
+    static_assert(unsigned_extremes::find(std::numeric_limits<std::uint64_t>::max()) == 1U);
+    static_assert(unsigned_extremes::find(1U) == 2U);
+
+    using signed_extremes = tag_router<typelist<message<std::numeric_limits<std::int64_t>::max()>, message<std::numeric_limits<std::int64_t>::min()>, message<std::int64_t{0}>>>;
+    static_assert(signed_extremes::strategy == route_strategy::sorted_search);
+    static_assert(signed_extremes::find(std::numeric_limits<std::int64_t>::min()) == 0U);
+    static_assert(signed_extremes::find(0) == 1U);
+    static_assert(signed_extremes::find(std::numeric_limits<std::int64_t>::max()) == 2U);
+    static_assert(signed_extremes::find(-1) == 3U);
+
+    using byte_extremes = tag_router<typelist<message<std::int8_t{127}>, message<std::int8_t{-128}>>>;
+    static_assert(byte_extremes::strategy == route_strategy::two_level);
+    static_assert(routed<byte_extremes>(-128) == -128);
+    static_assert(routed<byte_extremes>(127) == 127);
+    static_assert(routed<byte_extremes>(0) == -1);
+} // namespace TagRouter
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <tmp/TypeIndexed.hpp>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+using namespace tmp;
+
+namespace {
+    struct test1 {};
+    struct test2 {};
+    struct test3 {};
+
+    using list = typelist<test1, test2, test3>;
+} // namespace
+
+namespace TypeIndexedArray {
+    static_assert(type_indexed_array<list, int>::size() == 3U);
+    static_assert(sizeof(type_indexed_array<list, std::uint32_t>) == 3U * sizeof(std::uint32_t));
+
+    constexpr int sum_after_increments()
+    {
+        type_indexed_array<list, int> counters;
+        counters.get<test1>() += 1;
+        counters.get<test3>() += 10;
+        counters[index_of_v<test3, list>] += 100;
+        int sum = 0;
+        for (int value : counters) {
+            sum += value;
+        }
+        return sum * 1000 + counters[2];
+    }
+
+    static_assert(sum_after_increments() == 111110);
+} // namespace TypeIndexedArray
+
+namespace TypeIndexedTuple {
+    template<typename T>
+    struct handler
+    {
+        std::size_t calls = 0;
+    };
+
+    static_assert(type_indexed_tuple<list, handler>::size() == 3U);
+    static_assert(std::is_same_v<decltype(std::declval<type_indexed_tuple<list, handler>&>().get<test2>()), handler<test2>&>);
+    static_assert(std::is_same_v<decltype(std::declval<const type_indexed_tuple<list, handler>&>().get<test1>()), const handler<test1>&>);
+
+    constexpr std::size_t calls()
+    {
+        type_indexed_tuple<list, handler> handlers;
+        handlers.get<test2>().calls += 2;
+        handlers.get<test3>().calls += 3;
+        return handlers.get<test1>().calls * 100 + handlers.get<test2>().calls * 10 + handlers.get<test3>().calls;
+    }
+
+    static_assert(calls() == 23U);
+} // namespace TypeIndexedTuple
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <tmp/TypeName.hpp>
+
+using namespace tmp;
+
+// at global scope for the unqualified name, the name must not be used by another test file
+struct type_name_test {};
+
+namespace TypeName {
+    struct test2 {};
+    enum class test3 {};
+
+    static_assert(type_name_v<int> == "int");
+    static_assert(type_name_v<double> == "double");
+    static_assert(type_name_v<type_name_test> == "type_name_test");
+    static_assert(type_name_v<test2> == "TypeName::test2");
+    static_assert(type_name_v<test3> == "TypeName::test3");
+
+    static_assert(type_names_v<typelist<>>.empty());
+    static_assert(type_names_v<typelist<type_name_test, int>>[0] == "type_name_test");
+    static_assert(type_names_v<typelist<type_name_test, int>>[1] == "int");
+} // namespace TypeName
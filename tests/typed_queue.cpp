@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2025 Alexander Wachter
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime.hpp"
+#include <tmp/TypedQueue.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace tmp;
+
+namespace TypedQueue {
+    struct small { std::uint8_t value; };
+    struct medium { std::uint32_t values[5]; };
+    struct large { std::uint64_t values[8]; };
+
+    using sized_queue = typed_queue<typelist<small, medium, large>>;
+
+    // the header is a 32 bit size and an 8 bit tag, padded to 8 bytes
+    static_assert(sized_queue::record_alignment == 8U);
+    static_assert(sized_queue::payload_offset_at<small>(0U) == 8U);
+    static_assert(sized_queue::payload_offset_at<medium>(8U) == 8U);
+    static_assert(sized_queue::payload_offset_at<large>(16U) == 8U);
+    // records are sized per type, not to the largest type
+    static_assert(sized_queue::record_size<small> == 16U);
+    static_assert(sized_queue::record_size<medium> == 32U);
+    static_assert(sized_queue::record_size<large> == 72U);
+    static_assert(sized_queue::max_record_size == 72U);
+
+    // a type with a large alignment does not enlarge the records of the other types
+    struct alignas(32) aligned { char value; };
+    using aligned_queue = typed_queue<typelist<small, aligned>, queue_producers::multiple>;
+    static_assert(aligned_queue::record_alignment == 8U);
+    static_assert(aligned_queue::record_size<small> == 16U);
+    // the payload is aligned from where the record is, behind the header
+    static_assert(aligned_queue::payload_offset_at<aligned>(0U) == 32U);
+    static_assert(aligned_queue::payload_offset_at<aligned>(8U) == 24U);
+    static_assert(aligned_queue::payload_offset_at<aligned>(24U) == 8U);
+    static_assert(aligned_queue::record_size_at<aligned>(0U) == 64U);
+    static_assert(aligned_queue::record_size_at<aligned>(24U) == 40U);
+    static_assert(aligned_queue::record_size<aligned> == 64U);
+    static_assert(aligned_queue::max_record_size == 64U);
+
+    static_assert(!std::is_copy_constructible_v<typed_queue<typelist<std::string>>>);
+    static_assert(std::is_constructible_v<typed_queue<typelist<std::string>>, std::size_t>);
+} // namespace TypedQueue
+
+namespace TypedQueue {
+    struct value { int number; };
+
+    struct thrower
+    {
+        explicit thrower(int number)
+        {
+            if (number < 0) {
+                throw number;
+            }
+        }
+    };
+
+    template<queue_producers PRODUCERS>
+    void construction_throws()
+    {
+        typed_queue<typelist<value, thrower>, PRODUCERS> queue{256U};
+        runtime::check(queue.template emplace<value>(value{1}));
+        try {
+            queue.template emplace<thrower>(-1);
+            runtime::check(false);
+        } catch (int) {
+        }
+        runtime::check(queue.template emplace<value>(value{2}));
+
+        // the failed record is skipped
+        int expected = 1;
+        const std::size_t consumed = queue.consume([&expected]<typename T>(T& message) {
+            if constexpr (std::is_same_v<T, value>) {
+                runtime::check(message.number == expected);
+                ++expected;
+            } else {
+                runtime::check(false);
+            }
+        });
+        runtime::check(consumed == 2U);
+        runtime::check(!queue.consume_one([](auto&) { runtime::check(false); }));
+    }
+
+    template<queue_producers PRODUCERS>
+    void wrap_around()
+    {
+        // records of 16 and 72 bytes in 256 bytes, they do not divide the buffer, so records wrap with padding
+        typed_queue<typelist<small, large>, PRODUCERS> queue{0U};
+        runtime::check(queue.capacity() == 256U);
+
+        std::uint64_t produced = 0U;
+        std::uint64_t received = 0U;
+        const auto receive = [&received]<typename T>(T& message) {
+            if constexpr (std::is_same_v<T, small>) {
+                runtime::check(message.value == static_cast<std::uint8_t>(received));
+            } else {
+                runtime::check(message.values[0] == received && message.values[7] == received);
+            }
+            ++received;
+        };
+        for (int round = 0; round < 100; ++round) {
+            // fill until full, then drain, with the mix of types depending on the round
+            while (produced % 3U == static_cast<std::uint64_t>(round) % 3U
+                       ? queue.template emplace<large>(large{{produced, 0U, 0U, 0U, 0U, 0U, 0U, produced}})
+                       : queue.template emplace<small>(small{static_cast<std::uint8_t>(produced)})) {
+                ++produced;
+            }
+            runtime::check(produced - received > 1U);
+            queue.consume(receive);
+            runtime::check(received == produced);
+        }
+    }
+
+    template<queue_producers PRODUCERS>
+    void mixed_alignment()
+    {
+        // records of 16 bytes and of 40 to 64 bytes for the aligned type, depending on their position
+        typed_queue<typelist<small, aligned>, PRODUCERS> queue{0U};
+        runtime::check(queue.capacity() == 128U);
+
+        std::uint64_t produced = 0U;
+        std::uint64_t received = 0U;
+        const auto receive = [&received]<typename T>(T& message) {
+            if constexpr (std::is_same_v<T, aligned>) {
+                runtime::check(reinterpret_cast<std::uintptr_t>(&message) % alignof(aligned) == 0U);
+            }
+            runtime::check(static_cast<std::uint64_t>(static_cast<unsigned char>(message.value)) == received % 256U);
+            ++received;
+        };
+        for (int round = 0; round < 100; ++round) {
+            // the number of small records between the aligned ones moves the aligned records through all positions
+            while (produced % static_cast<std::uint64_t>(round % 4 + 2) == 0U
+                       ? queue.template emplace<aligned>(aligned{static_cast<char>(produced % 256U)})
+                       : queue.template emplace<small>(small{static_cast<std::uint8_t>(produced % 256U)})) {
+                ++produced;
+            }
+            queue.consume(receive);
+            runtime::check(received == produced);
+        }
+    }
+
+    // Producers retry until their message is accepted. A full queue is only reported while the queue is at least half full
+    void multiple_producers_stress()
+    {
+        struct sequenced
+        {
+            std::uint32_t producer;
+            std::uint32_t number;
+        };
+        using stress_queue = typed_queue<typelist<sequenced>, queue_producers::multiple>;
+        constexpr std::uint32_t producers = 4U;
+        constexpr std::uint32_t messages = 100000U;
+
+        stress_queue messages_queue{4096U};
+        constexpr std::size_t record_size = stress_queue::record_size<sequenced>;
+        // every record has the same size and the capacity is a power of two, so there is no padding
+        const std::uint64_t half_full = messages_queue.capacity() / record_size / 2U;
+
+        // started counts the messages that may be in the queue, consumed the messages that are not in it anymore
+        std::atomic<std::uint64_t> started{0U};
+        std::atomic<std::uint64_t> consumed{0U};
+        std::atomic<std::uint64_t> spurious_full{0U};
+
+        std::vector<std::thread> threads;
+        for (std::uint32_t producer = 0U; producer < producers; ++producer) {
+            threads.emplace_back([&, producer] {
+                for (std::uint32_t number = 0U; number < messages;) {
+                    const std::uint64_t consumed_before = consumed.load();
+                    started.fetch_add(1U);
+                    if (messages_queue.emplace<sequenced>(sequenced{producer, number})) {
+                        ++number;
+                        continue;
+                    }
+                    // upper bound of the records in the queue when emplace failed
+                    if (started.load() - consumed_before < half_full) {
+                        spurious_full.fetch_add(1U);
+                    }
+                    started.fetch_sub(1U);
+                    std::this_thread::yield();
+                }
+            });
+        }
+
+        std::uint32_t expected[producers] = {};
+        std::uint64_t received = 0U;
+        while (received < std::uint64_t{producers} * messages) {
+            const bool got = messages_queue.consume_one([&expected](sequenced& message) {
+                runtime::check(message.number == expected[message.producer]);
+                ++expected[message.producer];
+            });
+            if (got) {
+                ++received;
+                consumed.fetch_add(1U);
+            }
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        runtime::check(spurious_full.load() == 0U);
+        runtime::check(!messages_queue.consume_one([](auto&) { runtime::check(false); }));
+    }
+} // namespace TypedQueue
+
+void runtime::typed_queue()
+{
+    TypedQueue::construction_throws<queue_producers::single>();
+    TypedQueue::construction_throws<queue_producers::multiple>();
+    TypedQueue::wrap_around<queue_producers::single>();
+    TypedQueue::wrap_around<queue_producers::multiple>();
+    TypedQueue::mixed_alignment<queue_producers::single>();
+    TypedQueue::mixed_alignment<queue_producers::multiple>();
+    TypedQueue::multiple_producers_stress();
+}